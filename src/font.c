@@ -50,12 +50,28 @@
  *
  * Font-backends must take into account that this API must be thread-safe as it
  * is shared between different threads to reduce memory-footprint.
+ *
+ * Backends may rasterize expensive glyphs in the background. In that case
+ * kmscon_font_render() returns -EAGAIN together with a blank placeholder and
+ * the backend calls kmscon_font_notify() once the glyph is ready. Users that
+ * want this register an event-counter via kmscon_font_add_notifier() and
+ * redraw everything when it fires. Without any registered counter nobody would
+ * ever redraw, so backends must render synchronously then.
+ *
+ * Backends keep rendered glyphs in caches that are bounded by
+ * kmscon_font_set_cache_budget(). Glyphs are only guaranteed to stay valid
+ * until the next call to kmscon_font_next_frame(), which the text renderers
+ * call when they start drawing a new frame. Users must copy everything they
+ * need beyond that. As freed glyph buffers may be reused for other glyphs,
+ * anything kept beyond a frame must be keyed on the glyph and its style, see
+ * KMSCON_GLYPH_KEY(), and never on the address of a glyph or its buffer.
  */
 
 #include <errno.h>
 #include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include "eloop.h"
 #include "font.h"
 #include "kmscon_module.h"
 #include "shl_dlist.h"
@@ -67,6 +83,18 @@
 
 static struct shl_register font_reg = SHL_REGISTER_INIT(font_reg);
 
+struct notifier {
+	struct shl_dlist list;
+	struct ev_counter *cnt;
+};
+
+static pthread_mutex_t notify_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct shl_dlist notify__list = SHL_DLIST_INIT(notify__list);
+
+static size_t cache_budget = 8 << 20;
+/* read by the glyph workers of the backends, so always access it atomically */
+static unsigned long cache_frame;
+
 /**
  * kmscon_font_attr_normalize:
  * @attr: Attribute to normalize
@@ -383,33 +411,40 @@ void kmscon_font_unref(struct kmscon_font *font)
 /**
  * kmscon_font_render:
  * @font: Valid font object
- * @id: Unique ID that identifies @ch globally
- * @ch: Symbol to find a glyph for
- * @len: Length of @ch
+ * @req: Symbol and style to find a glyph for
  * @out: Output buffer for glyph
  *
- * Renders the glyph for symbol @sym and places a pointer to the glyph in @out.
- * If the glyph cannot be found or is invalid, an error is returned. The glyph
- * is cached internally and removed when the last reference to this font is
- * dropped.
+ * Renders the glyph for symbol @req->ch with style @req->style and places a
+ * pointer to the glyph in @out. @req->id is a unique ID that identifies
+ * @req->ch globally. If the glyph cannot be found or is invalid, an error is
+ * returned. The glyph is cached internally, each style separately, so users
+ * should use KMSCON_GLYPH_KEY() as key if they cache glyphs themselves.
+ * Backends that cannot render a style ignore it.
  * If the glyph is no available in this font-set, then -ERANGE is returned.
  *
+ * If the backend rasterizes the glyph in the background, -EAGAIN is returned
+ * and @out is set to a blank placeholder with the same width as the real glyph.
+ * The placeholder can be drawn but must not be cached as the glyph for @id;
+ * KMSCON_FONT_PENDING_ID() can be used as cache-key instead. All registered
+ * notifiers are signaled once the real glyph is available.
+ *
  * Returns: 0 on success, negative error code on failure
  */
 SHL_EXPORT
 int kmscon_font_render(struct kmscon_font *font,
-		       uint64_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph_req *req,
 		       const struct kmscon_glyph **out)
 {
-	if (!font || !out || !ch || !len)
+	if (!font || !out || !req || !req->ch || !req->len)
 		return -EINVAL;
 
-	return font->ops->render(font, id, ch, len, out);
+	return font->ops->render(font, req, out);
 }
 
 /**
  * kmscon_font_render_empty:
  * @font: Valid font object
+ * @style: Style of the glyph
  * @out: Output buffer for glyph
  *
  * Same as kmscon_font_render() but this renders a glyph that has no content and
@@ -419,18 +454,19 @@ int kmscon_font_render(struct kmscon_font *font,
  * Returns: 0 on success, negative error code on failure
  */
 SHL_EXPORT
-int kmscon_font_render_empty(struct kmscon_font *font,
+int kmscon_font_render_empty(struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out)
 {
 	if (!font || !out)
 		return -EINVAL;
 
-	return font->ops->render_empty(font, out);
+	return font->ops->render_empty(font, style, out);
 }
 
 /**
  * kmscon_font_render_inval:
  * @font: Valid font object
+ * @style: Style of the glyph
  * @out: Output buffer for glyph
  *
  * Same sa kmscon_font_render_empty() but renders a glyph that can be used as
@@ -441,11 +477,158 @@ int kmscon_font_render_empty(struct kmscon_font *font,
  * Returns: 0 on success ,engative error code on failure
  */
 SHL_EXPORT
-int kmscon_font_render_inval(struct kmscon_font *font,
+int kmscon_font_render_inval(struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out)
 {
 	if (!font || !out)
 		return -EINVAL;
 
-	return font->ops->render_inval(font, out);
+	return font->ops->render_inval(font, style, out);
+}
+
+/**
+ * kmscon_font_add_notifier:
+ * @cnt: Event counter to increment
+ *
+ * Registers @cnt so it is incremented whenever a font backend finished
+ * rasterizing a glyph in the background. See kmscon_font_render(). The counter
+ * may be incremented from any thread but never after
+ * kmscon_font_remove_notifier() returned.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+SHL_EXPORT
+int kmscon_font_add_notifier(struct ev_counter *cnt)
+{
+	struct notifier *n;
+
+	if (!cnt)
+		return -EINVAL;
+
+	n = malloc(sizeof(*n));
+	if (!n)
+		return -ENOMEM;
+	memset(n, 0, sizeof(*n));
+	n->cnt = cnt;
+
+	ev_counter_ref(cnt);
+	pthread_mutex_lock(&notify_mutex);
+	shl_dlist_link(&notify__list, &n->list);
+	pthread_mutex_unlock(&notify_mutex);
+
+	return 0;
+}
+
+/**
+ * kmscon_font_remove_notifier:
+ * @cnt: Event counter that was previously registered
+ *
+ * Removes @cnt again. If it was registered multiple times, only one
+ * registration is dropped.
+ */
+SHL_EXPORT
+void kmscon_font_remove_notifier(struct ev_counter *cnt)
+{
+	struct shl_dlist *iter;
+	struct notifier *n = NULL;
+
+	if (!cnt)
+		return;
+
+	pthread_mutex_lock(&notify_mutex);
+	shl_dlist_for_each(iter, &notify__list) {
+		n = shl_dlist_entry(iter, struct notifier, list);
+		if (n->cnt == cnt) {
+			shl_dlist_unlink(&n->list);
+			break;
+		}
+		n = NULL;
+	}
+	pthread_mutex_unlock(&notify_mutex);
+
+	if (n) {
+		ev_counter_unref(n->cnt);
+		free(n);
+	}
+}
+
+/**
+ * kmscon_font_can_defer:
+ *
+ * Returns: true if someone waits for kmscon_font_notify() so backends may
+ * return -EAGAIN from kmscon_font_render()
+ */
+SHL_EXPORT
+bool kmscon_font_can_defer(void)
+{
+	bool ret;
+
+	pthread_mutex_lock(&notify_mutex);
+	ret = !shl_dlist_empty(&notify__list);
+	pthread_mutex_unlock(&notify_mutex);
+
+	return ret;
+}
+
+/**
+ * kmscon_font_notify:
+ *
+ * Called by font backends from any thread after a glyph that was deferred via
+ * -EAGAIN has been rasterized. This increments all registered counters.
+ */
+SHL_EXPORT
+void kmscon_font_notify(void)
+{
+	struct shl_dlist *iter;
+	struct notifier *n;
+
+	pthread_mutex_lock(&notify_mutex);
+	shl_dlist_for_each(iter, &notify__list) {
+		n = shl_dlist_entry(iter, struct notifier, list);
+		ev_counter_inc(n->cnt, 1);
+	}
+	pthread_mutex_unlock(&notify_mutex);
+}
+
+/**
+ * kmscon_font_set_cache_budget:
+ * @budget: memory in bytes, 0 is unlimited
+ *
+ * Sets how much memory each font face may use for cached glyphs. This only
+ * affects fonts that are loaded afterwards.
+ */
+SHL_EXPORT
+void kmscon_font_set_cache_budget(size_t budget)
+{
+	cache_budget = budget;
+}
+
+SHL_EXPORT
+size_t kmscon_font_get_cache_budget(void)
+{
+	return cache_budget;
+}
+
+/**
+ * kmscon_font_next_frame:
+ *
+ * Starts a new frame. Glyphs that were returned by kmscon_font_render() and
+ * friends during the current frame are never evicted from the glyph caches
+ * before this is called again. Must be called from the rendering thread.
+ */
+SHL_EXPORT
+void kmscon_font_next_frame(void)
+{
+	__atomic_add_fetch(&cache_frame, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * kmscon_font_get_frame:
+ *
+ * Returns: the current frame, backends pass it to shl_cache_set_frame()
+ */
+SHL_EXPORT
+unsigned long kmscon_font_get_frame(void)
+{
+	return __atomic_load_n(&cache_frame, __ATOMIC_RELAXED);
 }
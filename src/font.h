@@ -41,6 +41,7 @@ struct kmscon_font_attr;
 struct kmscon_glyph;
 struct kmscon_font;
 struct kmscon_font_ops;
+struct ev_counter;
 
 #define KMSCON_FONT_MAX_NAME 128
 #define KMSCON_FONT_DEFAULT_NAME "monospace"
@@ -67,11 +68,26 @@ struct kmscon_glyph {
 	void *data;
 };
 
+/* glyph styles; bold is selected by the font itself and decorations like
+ * underlines are drawn by the text renderers */
+#define KMSCON_GLYPH_ITALIC		0x01
+
+struct kmscon_glyph_req {
+	uint64_t id;
+	const uint32_t *ch;
+	size_t len;
+	unsigned int style;
+};
+
+/* glyph IDs are 32bit symbols so the style fits above them */
+#define KMSCON_GLYPH_KEY(req) ((req)->id | ((uint64_t)(req)->style << 40))
+
 struct kmscon_font {
 	unsigned long ref;
 	struct shl_register_record *record;
 	const struct kmscon_font_ops *ops;
 	struct kmscon_font_attr attr;
+	/* distance from the top of a glyph to its baseline in pixels */
 	unsigned int baseline;
 	void *data;
 };
@@ -83,11 +99,11 @@ struct kmscon_font_ops {
 		     const struct kmscon_font_attr *attr);
 	void (*destroy) (struct kmscon_font *font);
 	int (*render) (struct kmscon_font *font,
-		       uint64_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph_req *req,
 		       const struct kmscon_glyph **out);
-	int (*render_empty) (struct kmscon_font *font,
+	int (*render_empty) (struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out);
-	int (*render_inval) (struct kmscon_font *font,
+	int (*render_inval) (struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out);
 };
 
@@ -101,13 +117,36 @@ void kmscon_font_ref(struct kmscon_font *font);
 void kmscon_font_unref(struct kmscon_font *font);
 
 int kmscon_font_render(struct kmscon_font *font,
-		       uint64_t id, const uint32_t *ch, size_t len,
+		       const struct kmscon_glyph_req *req,
 		       const struct kmscon_glyph **out);
-int kmscon_font_render_empty(struct kmscon_font *font,
+int kmscon_font_render_empty(struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out);
-int kmscon_font_render_inval(struct kmscon_font *font,
+int kmscon_font_render_inval(struct kmscon_font *font, unsigned int style,
 			     const struct kmscon_glyph **out);
 
+/* asynchronous rendering */
+
+/*
+ * While a glyph is rendered in the background, kmscon_font_render() returns
+ * -EAGAIN and a blank placeholder. Renderers cache the placeholder under this
+ * ID instead of the glyph's own ID, so the real glyph is looked up again on
+ * the next redraw. Glyph IDs are 32bit symbols so this never clashes with a
+ * real glyph.
+ */
+#define KMSCON_FONT_PENDING_ID(width) ((1ULL << 32) | (width))
+
+int kmscon_font_add_notifier(struct ev_counter *cnt);
+void kmscon_font_remove_notifier(struct ev_counter *cnt);
+bool kmscon_font_can_defer(void);
+void kmscon_font_notify(void);
+
+/* glyph caches */
+
+void kmscon_font_set_cache_budget(size_t budget);
+size_t kmscon_font_get_cache_budget(void);
+void kmscon_font_next_frame(void);
+unsigned long kmscon_font_get_frame(void);
+
 /* modularized backends */
 
 extern struct kmscon_font_ops kmscon_font_8x16_ops;
@@ -41,7 +41,8 @@
  * There is also no sophisticated font handling in here so this should only be
  * used as last fallback when external libraries failed. However, this also
  * means this backend is _very_ fast as no rendering is needed. Everything is
- * pre-rendered. See the big array at the end of this file for the bitmap.
+ * pre-rendered. See the big array at the end of this file for the bitmap. The
+ * glyphs are stored as UTERM_FORMAT_MONO, one byte per row.
  */
 
 #include <errno.h>
@@ -70,7 +71,7 @@ static int kmscon_font_8x16_init(struct kmscon_font *out,
 	out->attr.width = 8;
 	out->attr.height = 16;
 	kmscon_font_attr_normalize(&out->attr);
-	out->baseline = 4;
+	out->baseline = 12;
 
 	return 0;
 }
@@ -81,17 +82,18 @@ static void kmscon_font_8x16_destroy(struct kmscon_font *font)
 }
 
 static int kmscon_font_8x16_render(struct kmscon_font *font,
-				   uint64_t id, const uint32_t *ch, size_t len,
+				   const struct kmscon_glyph_req *req,
 				   const struct kmscon_glyph **out)
 {
-	if (len > 1 || *ch >= 256)
+	if (req->len > 1 || *req->ch >= 256)
 		return -ERANGE;
 
-	*out = &kmscon_font_8x16_glyphs[*ch];
+	*out = &kmscon_font_8x16_glyphs[*req->ch];
 	return 0;
 }
 
 static int kmscon_font_8x16_render_empty(struct kmscon_font *font,
+					 unsigned int style,
 					 const struct kmscon_glyph **out)
 {
 	*out = &kmscon_font_8x16_glyphs[0];
@@ -99,6 +101,7 @@ static int kmscon_font_8x16_render_empty(struct kmscon_font *font,
 }
 
 static int kmscon_font_8x16_render_inval(struct kmscon_font *font,
+					 unsigned int style,
 					 const struct kmscon_glyph **out)
 {
 	*out = &kmscon_font_8x16_glyphs['?'];
@@ -121,41 +124,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -164,40 +139,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7e, 0x81,
+				0xa5, 0x81, 0x81, 0xbd,
+				0x99, 0x81, 0x81, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -207,40 +154,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7e, 0xff,
+				0xdb, 0xff, 0xff, 0xc3,
+				0xe7, 0xff, 0xff, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -250,40 +169,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x6c, 0xfe, 0xfe, 0xfe,
+				0xfe, 0x7c, 0x38, 0x10,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -293,40 +184,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x10, 0x38, 0x7c, 0xfe,
+				0x7c, 0x38, 0x10, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -336,40 +199,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x18,
+				0x3c, 0x3c, 0xe7, 0xe7,
+				0xe7, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -379,40 +214,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x18,
+				0x3c, 0x7e, 0xff, 0xff,
+				0x7e, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -422,40 +229,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x3c,
+				0x3c, 0x18, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -465,40 +244,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+				0xff, 0xff, 0xe7, 0xc3,
+				0xc3, 0xe7, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0xff,
 			},
 		},
@@ -508,40 +259,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x3c, 0x66, 0x42,
+				0x42, 0x66, 0x3c, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -551,40 +274,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
+				0xff, 0xc3, 0x99, 0xbd,
+				0xbd, 0x99, 0xc3, 0xff,
 				0xff, 0xff, 0xff, 0xff,
 			},
 		},
@@ -594,83 +289,27 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
+				0x00, 0x00, 0x1e, 0x0e,
+				0x1a, 0x32, 0x78, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x78,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 12 0x0c */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 12 0x0c */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x3c, 0x66,
+				0x66, 0x66, 0x66, 0x3c,
+				0x18, 0x7e, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -680,40 +319,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3f, 0x33,
+				0x3f, 0x30, 0x30, 0x30,
+				0x30, 0x70, 0xf0, 0xe0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -723,41 +334,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7f, 0x63,
+				0x7f, 0x63, 0x63, 0x63,
+				0x63, 0x67, 0xe7, 0xe6,
+				0xc0, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -766,40 +349,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x18,
+				0x18, 0xdb, 0x3c, 0xe7,
+				0x3c, 0xdb, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -809,40 +364,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x80, 0xc0, 0xe0,
+				0xf0, 0xf8, 0xfe, 0xf8,
+				0xf0, 0xe0, 0xc0, 0x80,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -852,40 +379,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x02, 0x06, 0x0e,
+				0x1e, 0x3e, 0xfe, 0x3e,
+				0x1e, 0x0e, 0x06, 0x02,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -895,40 +394,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x3c,
+				0x7e, 0x18, 0x18, 0x18,
+				0x7e, 0x3c, 0x18, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -938,40 +409,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x66,
+				0x66, 0x00, 0x66, 0x66,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -981,40 +424,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7f, 0xdb,
+				0xdb, 0xdb, 0x7b, 0x1b,
+				0x1b, 0x1b, 0x1b, 0x1b,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1024,41 +439,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0x60,
+				0x38, 0x6c, 0xc6, 0xc6,
+				0x6c, 0x38, 0x0c, 0xc6,
+				0x7c, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1067,40 +454,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0xfe, 0xfe, 0xfe, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1110,40 +469,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x3c,
+				0x7e, 0x18, 0x18, 0x18,
+				0x7e, 0x3c, 0x18, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1153,40 +484,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x3c,
+				0x7e, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1196,40 +499,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x7e, 0x3c, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1239,40 +514,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x0c, 0xfe,
+				0x0c, 0x18, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1282,40 +529,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x30, 0x60, 0xfe,
+				0x60, 0x30, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1325,40 +544,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc0, 0xc0,
+				0xc0, 0xfe, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1368,40 +559,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x28, 0x6c, 0xfe,
+				0x6c, 0x28, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1411,40 +574,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x10, 0x38, 0x38, 0x7c,
+				0x7c, 0xfe, 0xfe, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1454,40 +589,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0xfe, 0xfe, 0x7c, 0x7c,
+				0x38, 0x38, 0x10, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1497,41 +604,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -1540,40 +619,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x3c,
+				0x3c, 0x3c, 0x18, 0x18,
+				0x18, 0x00, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1583,39 +634,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x66, 0x66, 0x66,
+				0x24, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -1626,40 +649,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x6c,
+				0x6c, 0xfe, 0x6c, 0x6c,
+				0x6c, 0xfe, 0x6c, 0x6c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1669,41 +664,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x7c, 0xc6,
+				0xc2, 0xc0, 0x7c, 0x06,
+				0x06, 0x86, 0xc6, 0x7c,
+				0x18, 0x18, 0x00, 0x00,
 			},
 		},
 	},
@@ -1712,40 +679,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0xc2, 0xc6, 0x0c, 0x18,
+				0x30, 0x60, 0xc6, 0x86,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1755,40 +694,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x6c,
+				0x6c, 0x38, 0x76, 0xdc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1798,39 +709,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x30, 0x30, 0x30,
+				0x60, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -1841,40 +724,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x0c, 0x18,
+				0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x18, 0x0c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1884,40 +739,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x30, 0x18,
+				0x0c, 0x0c, 0x0c, 0x0c,
+				0x0c, 0x0c, 0x18, 0x30,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1927,40 +754,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x66, 0x3c, 0xff,
+				0x3c, 0x66, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -1970,40 +769,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x7e,
+				0x18, 0x18, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2013,41 +784,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x18,
+				0x30, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -2056,39 +799,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -2099,40 +814,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2142,83 +829,27 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x02, 0x06, 0x0c, 0x18,
+				0x30, 0x60, 0xc0, 0x80,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 48 0x30 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 48 0x30 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x38, 0x6c,
+				0xc6, 0xc6, 0xd6, 0xd6,
+				0xc6, 0xc6, 0x6c, 0x38,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2228,40 +859,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x38,
+				0x78, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2271,40 +874,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0x06, 0x0c, 0x18, 0x30,
+				0x60, 0xc0, 0xc6, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2314,40 +889,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0x06, 0x06, 0x3c, 0x06,
+				0x06, 0x06, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2357,40 +904,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x0c, 0x1c,
+				0x3c, 0x6c, 0xcc, 0xfe,
+				0x0c, 0x0c, 0x0c, 0x1e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2400,40 +919,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc0,
+				0xc0, 0xc0, 0xfc, 0x06,
+				0x06, 0x06, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2443,40 +934,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x60,
+				0xc0, 0xc0, 0xfc, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2486,40 +949,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc6,
+				0x06, 0x06, 0x0c, 0x18,
+				0x30, 0x30, 0x30, 0x30,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2529,40 +964,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0xc6, 0x7c, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2572,40 +979,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0xc6, 0x7e, 0x06,
+				0x06, 0x06, 0x0c, 0x78,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2615,40 +994,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2658,40 +1009,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x30,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2701,83 +1024,27 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x06,
+				0x0c, 0x18, 0x30, 0x60,
+				0x30, 0x18, 0x0c, 0x06,
 				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 61 0x3d */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 61 0x3d */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7e, 0x00, 0x00,
+				0x7e, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2787,40 +1054,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x60,
+				0x30, 0x18, 0x0c, 0x06,
+				0x0c, 0x18, 0x30, 0x60,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2830,40 +1069,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0x0c, 0x18, 0x18,
+				0x18, 0x00, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2873,40 +1084,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x7c,
+				0xc6, 0xc6, 0xde, 0xde,
+				0xde, 0xdc, 0xc0, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2916,40 +1099,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x10, 0x38,
+				0x6c, 0xc6, 0xc6, 0xfe,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -2959,40 +1114,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfc, 0x66,
+				0x66, 0x66, 0x7c, 0x66,
+				0x66, 0x66, 0x66, 0xfc,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3002,40 +1129,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x66,
+				0xc2, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc2, 0x66, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3045,40 +1144,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xf8, 0x6c,
+				0x66, 0x66, 0x66, 0x66,
+				0x66, 0x66, 0x6c, 0xf8,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3088,40 +1159,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0x66,
+				0x62, 0x68, 0x78, 0x68,
+				0x60, 0x62, 0x66, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3131,40 +1174,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0x66,
+				0x62, 0x68, 0x78, 0x68,
+				0x60, 0x60, 0x60, 0xf0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3174,40 +1189,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x66,
+				0xc2, 0xc0, 0xc0, 0xde,
+				0xc6, 0xc6, 0x66, 0x3a,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3217,40 +1204,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xfe, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3260,40 +1219,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3303,40 +1234,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x1e, 0x0c,
+				0x0c, 0x0c, 0x0c, 0x0c,
+				0xcc, 0xcc, 0xcc, 0x78,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3346,40 +1249,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xe6, 0x66,
+				0x66, 0x6c, 0x78, 0x78,
+				0x6c, 0x66, 0x66, 0xe6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3389,40 +1264,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xf0, 0x60,
+				0x60, 0x60, 0x60, 0x60,
+				0x60, 0x62, 0x66, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3432,40 +1279,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xee,
+				0xfe, 0xfe, 0xd6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3475,40 +1294,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xe6,
+				0xf6, 0xfe, 0xde, 0xce,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3518,40 +1309,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3561,40 +1324,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfc, 0x66,
+				0x66, 0x66, 0x7c, 0x60,
+				0x60, 0x60, 0x60, 0xf0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3604,41 +1339,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xd6, 0xde, 0x7c,
+				0x0c, 0x0e, 0x00, 0x00,
 			},
 		},
 	},
@@ -3647,40 +1354,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfc, 0x66,
+				0x66, 0x66, 0x7c, 0x6c,
+				0x66, 0x66, 0x66, 0xe6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3690,40 +1369,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7c, 0xc6,
+				0xc6, 0x60, 0x38, 0x0c,
+				0x06, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3733,40 +1384,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x7e, 0x7e,
+				0x5a, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3776,40 +1399,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3819,40 +1414,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0x6c, 0x38, 0x10,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3862,40 +1429,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xd6, 0xd6,
+				0xd6, 0xfe, 0xee, 0x6c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3905,40 +1444,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0xc6,
+				0x6c, 0x7c, 0x38, 0x38,
+				0x7c, 0x6c, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3948,40 +1459,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x66, 0x66,
+				0x66, 0x66, 0x3c, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -3991,40 +1474,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc6,
+				0x86, 0x0c, 0x18, 0x30,
+				0x60, 0xc2, 0xc6, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4034,40 +1489,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x30,
+				0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4077,40 +1504,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x80,
+				0xc0, 0xe0, 0x70, 0x38,
+				0x1c, 0x0e, 0x06, 0x02,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4120,40 +1519,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x0c,
+				0x0c, 0x0c, 0x0c, 0x0c,
+				0x0c, 0x0c, 0x0c, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4163,38 +1534,10 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x10, 0x38, 0x6c, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
@@ -4206,41 +1549,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xff, 0x00, 0x00,
 			},
 		},
 	},
@@ -4249,38 +1564,10 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x30, 0x18, 0x0c,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
@@ -4292,40 +1579,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4335,40 +1594,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xe0, 0x60,
+				0x60, 0x78, 0x6c, 0x66,
+				0x66, 0x66, 0x66, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4378,40 +1609,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0xc0,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4421,40 +1624,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x1c, 0x0c,
+				0x0c, 0x3c, 0x6c, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4464,40 +1639,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4507,40 +1654,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x1c, 0x36,
+				0x32, 0x30, 0x78, 0x30,
+				0x30, 0x30, 0x30, 0x78,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4550,41 +1669,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x76, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x7c,
+				0x0c, 0xcc, 0x78, 0x00,
 			},
 		},
 	},
@@ -4593,40 +1684,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xe0, 0x60,
+				0x60, 0x6c, 0x76, 0x66,
+				0x66, 0x66, 0x66, 0xe6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4636,40 +1699,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18,
+				0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4679,41 +1714,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x06, 0x06,
+				0x00, 0x0e, 0x06, 0x06,
+				0x06, 0x06, 0x06, 0x06,
+				0x66, 0x66, 0x3c, 0x00,
 			},
 		},
 	},
@@ -4722,40 +1729,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xe0, 0x60,
+				0x60, 0x66, 0x6c, 0x78,
+				0x78, 0x6c, 0x66, 0xe6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4765,40 +1744,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4808,40 +1759,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xec, 0xfe, 0xd6,
+				0xd6, 0xd6, 0xd6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4851,40 +1774,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x66,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4894,40 +1789,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -4937,41 +1804,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x7c,
+				0x60, 0x60, 0xf0, 0x00,
 			},
 		},
 	},
@@ -4980,41 +1819,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x76, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x7c,
+				0x0c, 0x0c, 0x1e, 0x00,
 			},
 		},
 	},
@@ -5023,40 +1834,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xdc, 0x76, 0x66,
+				0x60, 0x60, 0x60, 0xf0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5066,40 +1849,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0x60,
+				0x38, 0x0c, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5109,40 +1864,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x10, 0x30,
+				0x30, 0xfc, 0x30, 0x30,
+				0x30, 0x30, 0x36, 0x1c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5152,40 +1879,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5195,40 +1894,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0x6c, 0x38,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5238,40 +1909,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0xc6, 0xd6,
+				0xd6, 0xd6, 0xfe, 0x6c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5281,40 +1924,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0x6c, 0x38,
+				0x38, 0x38, 0x6c, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5324,41 +1939,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7e,
+				0x06, 0x0c, 0xf8, 0x00,
 			},
 		},
 	},
@@ -5367,40 +1954,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xfe, 0xcc, 0x18,
+				0x30, 0x60, 0xc6, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5410,40 +1969,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x0e, 0x18,
+				0x18, 0x18, 0x70, 0x18,
+				0x18, 0x18, 0x18, 0x0e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5453,40 +1984,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5496,40 +1999,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x70, 0x18,
+				0x18, 0x18, 0x0e, 0x18,
+				0x18, 0x18, 0x18, 0x70,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5539,38 +2014,10 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x76, 0xdc, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
@@ -5582,40 +2029,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x10, 0x38, 0x6c, 0xc6,
+				0xc6, 0xc6, 0xfe, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5625,41 +2044,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x66,
+				0xc2, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc2, 0x66, 0x3c,
+				0x18, 0x70, 0x00, 0x00,
 			},
 		},
 	},
@@ -5668,40 +2059,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xcc, 0x00,
+				0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5711,40 +2074,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x0c, 0x18, 0x30,
+				0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5754,40 +2089,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x10, 0x38, 0x6c,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5797,40 +2104,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xcc, 0x00,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5840,40 +2119,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0x30, 0x18,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5883,40 +2134,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x38, 0x6c, 0x38,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -5926,41 +2149,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7c, 0xc6, 0xc0,
+				0xc0, 0xc0, 0xc6, 0x7c,
+				0x18, 0x70, 0x00, 0x00,
 			},
 		},
 	},
@@ -5969,40 +2164,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x10, 0x38, 0x6c,
+				0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6012,40 +2179,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0x00,
+				0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6055,40 +2194,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0x30, 0x18,
+				0x00, 0x7c, 0xc6, 0xfe,
+				0xc0, 0xc0, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6098,40 +2209,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x66, 0x00,
+				0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6141,40 +2224,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x3c, 0x66,
+				0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6184,40 +2239,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0x30, 0x18,
+				0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6227,40 +2254,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0x00, 0x10,
+				0x38, 0x6c, 0xc6, 0xc6,
+				0xfe, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6270,40 +2269,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x38, 0x6c, 0x38, 0x10,
+				0x38, 0x6c, 0xc6, 0xfe,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6313,40 +2284,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x0c, 0x18, 0x00, 0xfe,
+				0x66, 0x62, 0x68, 0x78,
+				0x68, 0x62, 0x66, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6356,40 +2299,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xec, 0x36, 0x36,
+				0x7e, 0xd8, 0xd8, 0x6e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6399,40 +2314,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3e, 0x6c,
+				0xcc, 0xcc, 0xfe, 0xcc,
+				0xcc, 0xcc, 0xcc, 0xce,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6442,40 +2329,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x10, 0x38, 0x6c,
+				0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6485,83 +2344,27 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
+				0x00, 0x00, 0xc6, 0x00,
+				0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 149 0x95 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 149 0x95 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x60, 0x30, 0x18,
+				0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6571,40 +2374,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x30, 0x78, 0xcc,
+				0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6614,40 +2389,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0x30, 0x18,
+				0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6657,41 +2404,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xc6, 0x00,
+				0x00, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7e,
+				0x06, 0x0c, 0x78, 0x00,
 			},
 		},
 	},
@@ -6700,40 +2419,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0x00, 0x7c,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6743,40 +2434,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xc6, 0x00, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6786,40 +2449,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x18, 0x7c,
+				0xc6, 0xc0, 0xc0, 0xc0,
+				0xc6, 0x7c, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6829,40 +2464,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x38, 0x6c, 0x64,
+				0x60, 0xf0, 0x60, 0x60,
+				0x60, 0x60, 0xe6, 0xfc,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6872,40 +2479,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x66, 0x66,
+				0x3c, 0x18, 0x7e, 0x18,
+				0x7e, 0x18, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6915,40 +2494,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xf8, 0xcc, 0xcc,
+				0xf8, 0xc4, 0xcc, 0xde,
+				0xcc, 0xcc, 0xcc, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -6958,40 +2509,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x0e, 0x1b, 0x18,
+				0x18, 0x18, 0x7e, 0x18,
+				0x18, 0x18, 0xd8, 0x70,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7001,40 +2524,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x30, 0x60,
+				0x00, 0x78, 0x0c, 0x7c,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7044,40 +2539,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x0c, 0x18, 0x30,
+				0x00, 0x38, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7087,40 +2554,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x30, 0x60,
+				0x00, 0x7c, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7130,40 +2569,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x30, 0x60,
+				0x00, 0xcc, 0xcc, 0xcc,
+				0xcc, 0xcc, 0xcc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7173,40 +2584,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x76, 0xdc,
+				0x00, 0xdc, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x66,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7216,40 +2599,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x76, 0xdc, 0x00, 0xc6,
+				0xe6, 0xf6, 0xfe, 0xde,
+				0xce, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7259,39 +2614,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x3c, 0x6c,
+				0x6c, 0x3e, 0x00, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -7302,39 +2629,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x6c,
+				0x6c, 0x38, 0x00, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -7345,40 +2644,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x30, 0x30,
+				0x00, 0x30, 0x30, 0x60,
+				0xc0, 0xc6, 0xc6, 0x7c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7388,40 +2659,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc0,
+				0xc0, 0xc0, 0xc0, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7431,40 +2674,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0x06,
+				0x06, 0x06, 0x06, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7474,41 +2689,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0xe0, 0x62,
+				0x66, 0x6c, 0x18, 0x30,
+				0x60, 0xdc, 0x86, 0x0c,
+				0x18, 0x3e, 0x00, 0x00,
 			},
 		},
 	},
@@ -7517,41 +2704,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x60, 0xe0, 0x62,
+				0x66, 0x6c, 0x18, 0x30,
+				0x66, 0xce, 0x9a, 0x3f,
+				0x06, 0x06, 0x00, 0x00,
 			},
 		},
 	},
@@ -7560,40 +2719,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x18, 0x18,
+				0x00, 0x18, 0x18, 0x18,
+				0x3c, 0x3c, 0x3c, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7603,40 +2734,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x36, 0x6c, 0xd8,
+				0x6c, 0x36, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7646,40 +2749,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xd8, 0x6c, 0x36,
+				0x6c, 0xd8, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -7689,41 +2764,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0x00, 0x00,
+				0x11, 0x44, 0x11, 0x44,
+				0x11, 0x44, 0x11, 0x44,
+				0x11, 0x44, 0x11, 0x44,
+				0x11, 0x44, 0x11, 0x44,
 			},
 		},
 	},
@@ -7732,41 +2779,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0x00,
-				0xff, 0x00, 0xff, 0x00,
+				0x55, 0xaa, 0x55, 0xaa,
+				0x55, 0xaa, 0x55, 0xaa,
+				0x55, 0xaa, 0x55, 0xaa,
+				0x55, 0xaa, 0x55, 0xaa,
 			},
 		},
 	},
@@ -7775,41 +2794,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0xdd, 0x77, 0xdd, 0x77,
+				0xdd, 0x77, 0xdd, 0x77,
+				0xdd, 0x77, 0xdd, 0x77,
+				0xdd, 0x77, 0xdd, 0x77,
 			},
 		},
 	},
@@ -7818,41 +2809,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7861,41 +2824,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7904,41 +2839,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0xf8, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -7947,41 +2854,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0xf6,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -7990,41 +2869,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x00, 0x00, 0x00, 0xfe,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8033,41 +2884,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x00, 0xf8, 0x18, 0xf8,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8076,41 +2899,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0xf6, 0x06, 0xf6,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8119,41 +2914,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8162,41 +2929,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x00, 0xfe, 0x06, 0xf6,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -8205,39 +2944,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0xf6, 0x06, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -8248,39 +2959,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -8291,39 +2974,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0xf8, 0x18, 0xf8,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -8334,41 +2989,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0xf8,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -8377,39 +3004,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x1f,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -8420,39 +3019,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -8463,729 +3034,253 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0xff,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+			},
+		},
+	},
+	{ /* 195 0xc3 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+			},
+		},
+	},
+	{ /* 196 0xc4 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 195 0xc3 */
+	{ /* 197 0xc5 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0xff,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
-	{ /* 196 0xc4 */
+	{ /* 198 0xc6 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x1f, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
-	{ /* 197 0xc5 */
+	{ /* 199 0xc7 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x37,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
-	{ /* 198 0xc6 */
+	{ /* 200 0xc8 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x37, 0x30, 0x3f,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 199 0xc7 */
+	{ /* 201 0xc9 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x3f, 0x30, 0x37,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
-	{ /* 200 0xc8 */
+	{ /* 202 0xca */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0xf7, 0x00, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 201 0xc9 */
+	{ /* 203 0xcb */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x00, 0xff, 0x00, 0xf7,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
-	{ /* 202 0xca */
+	{ /* 204 0xcc */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x37, 0x30, 0x37,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
-	{ /* 203 0xcb */
+	{ /* 205 0xcd */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xff, 0x00, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
 			},
 		},
 	},
-	{ /* 204 0xcc */
+	{ /* 206 0xce */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0xf7, 0x00, 0xf7,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
-	{ /* 205 0xcd */
+	{ /* 207 0xcf */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0xff, 0x00, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 206 0xce */
+	{ /* 208 0xd0 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
 			},
 		},
 	},
-	{ /* 207 0xcf */
+	{ /* 209 0xd1 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xff, 0x00, 0xff,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
-	{ /* 208 0xd0 */
+	{ /* 210 0xd2 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 209 0xd1 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 210 0xd2 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9194,39 +3289,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x3f,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -9237,39 +3304,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x1f, 0x18, 0x1f,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -9280,41 +3319,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x00, 0x1f, 0x18, 0x1f,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -9323,41 +3334,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x00, 0x00, 0x00, 0x3f,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9366,41 +3349,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0xff,
+				0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36,
 			},
 		},
 	},
@@ -9409,728 +3364,252 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0xff, 0x18, 0xff,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
 	{ /* 217 0xd9 */
 		.width = 1,
 		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 218 0xda */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-			},
-		},
-	},
-	{ /* 219 0xdb */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 220 0xdc */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-			},
-		},
-	},
-	{ /* 221 0xdd */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0xf8,
 				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 222 0xde */
+	{ /* 218 0xda */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
+				0x00, 0x00, 0x00, 0x1f,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
-	{ /* 223 0xdf */
+	{ /* 219 0xdb */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0xff, 0xff, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0xff,
+			},
+		},
+	},
+	{ /* 220 0xdc */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0xff,
 				0xff, 0xff, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 224 0xe0 */
+	{ /* 221 0xdd */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0xf0, 0xf0, 0xf0, 0xf0,
+				0xf0, 0xf0, 0xf0, 0xf0,
+				0xf0, 0xf0, 0xf0, 0xf0,
+				0xf0, 0xf0, 0xf0, 0xf0,
 			},
 		},
 	},
-	{ /* 225 0xe1 */
+	{ /* 222 0xde */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x0f, 0x0f, 0x0f, 0x0f,
+				0x0f, 0x0f, 0x0f, 0x0f,
+				0x0f, 0x0f, 0x0f, 0x0f,
+				0x0f, 0x0f, 0x0f, 0x0f,
 			},
 		},
 	},
-	{ /* 226 0xe2 */
+	{ /* 223 0xdf */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 				0xff, 0xff, 0xff, 0xff,
 				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 227 0xe3 */
+	{ /* 224 0xe0 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x76, 0xdc, 0xd8,
+				0xd8, 0xd8, 0xdc, 0x76,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 228 0xe4 */
+	{ /* 225 0xe1 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x78, 0xcc,
+				0xcc, 0xcc, 0xd8, 0xcc,
+				0xc6, 0xc6, 0xc6, 0xcc,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 229 0xe5 */
+	{ /* 226 0xe2 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc6,
+				0xc6, 0xc0, 0xc0, 0xc0,
+				0xc0, 0xc0, 0xc0, 0xc0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 230 0xe6 */
+	{ /* 227 0xe3 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0xfe, 0x6c, 0x6c,
+				0x6c, 0x6c, 0x6c, 0x6c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 231 0xe7 */
+	{ /* 228 0xe4 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0xfe, 0xc6,
+				0x60, 0x30, 0x18, 0x18,
+				0x30, 0x60, 0xc6, 0xfe,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
-	{ /* 232 0xe8 */
+	{ /* 229 0xe5 */
 		.width = 1,
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7e, 0xd8, 0xd8,
+				0xd8, 0xd8, 0xd8, 0x70,
 				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 230 0xe6 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x66, 0x66, 0x66,
+				0x66, 0x66, 0x66, 0x7c,
+				0x60, 0x60, 0xc0, 0x00,
+			},
+		},
+	},
+	{ /* 231 0xe7 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x76, 0xdc, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 				0x00, 0x00, 0x00, 0x00,
+			},
+		},
+	},
+	{ /* 232 0xe8 */
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x7e, 0x18,
+				0x3c, 0x66, 0x66, 0x66,
+				0x66, 0x3c, 0x18, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10140,40 +3619,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x6c,
+				0xc6, 0xc6, 0xfe, 0xc6,
+				0xc6, 0xc6, 0x6c, 0x38,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10183,40 +3634,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x38, 0x6c,
+				0xc6, 0xc6, 0xc6, 0x6c,
+				0x6c, 0x6c, 0x6c, 0xee,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10226,40 +3649,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x1e, 0x30,
+				0x18, 0x0c, 0x3e, 0x66,
+				0x66, 0x66, 0x66, 0x3c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10269,40 +3664,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x7e, 0xdb, 0xdb,
+				0xdb, 0x7e, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10312,40 +3679,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x03,
+				0x06, 0x7e, 0xdb, 0xdb,
+				0xf3, 0x7e, 0x60, 0xc0,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10355,40 +3694,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x1c, 0x30,
+				0x60, 0x60, 0x7c, 0x60,
+				0x60, 0x60, 0x30, 0x1c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10398,40 +3709,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x7c,
+				0xc6, 0xc6, 0xc6, 0xc6,
+				0xc6, 0xc6, 0xc6, 0xc6,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10441,40 +3724,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0xfe, 0x00, 0x00, 0xfe,
+				0x00, 0x00, 0xfe, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10484,40 +3739,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x7e, 0x18,
+				0x18, 0x00, 0x00, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10527,40 +3754,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x30,
+				0x18, 0x0c, 0x06, 0x0c,
+				0x18, 0x30, 0x00, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10570,84 +3769,28 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x0c,
+				0x18, 0x30, 0x60, 0x30,
+				0x18, 0x0c, 0x00, 0x7e,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
 	{ /* 244 0xf4 */
-		.width = 1,
-		.buf = {
-			.width = 8,
-			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
-			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
+		.width = 1,
+		.buf = {
+			.width = 8,
+			.height = 16,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
+			.data = (uint8_t[]){
+				0x00, 0x00, 0x0e, 0x1b,
+				0x1b, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
 			},
 		},
 	},
@@ -10656,41 +3799,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0x18, 0x18, 0x18,
+				0x18, 0xd8, 0xd8, 0xd8,
+				0x70, 0x00, 0x00, 0x00,
 			},
 		},
 	},
@@ -10699,40 +3814,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x18, 0x00, 0x7e,
+				0x00, 0x18, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10742,40 +3829,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x76, 0xdc, 0x00,
+				0x76, 0xdc, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10785,39 +3844,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x38, 0x6c, 0x6c,
+				0x38, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -10828,40 +3859,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x18,
+				0x18, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10871,39 +3874,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x18,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -10914,40 +3889,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0xff,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0xff, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x0f, 0x0c, 0x0c,
+				0x0c, 0x0c, 0x0c, 0xec,
+				0x6c, 0x6c, 0x3c, 0x1c,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -10957,39 +3904,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x6c, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -11000,39 +3919,11 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0xff, 0xff, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0xff,
-				0xff, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0xff, 0xff,
-				0x00, 0x00, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x3c, 0x66, 0x0c,
+				0x18, 0x32, 0x7e, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
@@ -11043,40 +3934,12 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0xff, 0xff, 0xff,
-				0xff, 0xff, 0xff, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x7e, 0x7e, 0x7e, 0x7e,
+				0x7e, 0x7e, 0x7e, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			},
 		},
@@ -11086,41 +3949,13 @@ static const struct kmscon_glyph kmscon_font_8x16_glyphs[256] = {
 		.buf = {
 			.width = 8,
 			.height = 16,
-			.stride = 8,
-			.format = UTERM_FORMAT_GREY,
+			.stride = 1,
+			.format = UTERM_FORMAT_MONO,
 			.data = (uint8_t[]){
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
 			},
 		},
 	},
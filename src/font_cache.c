@@ -0,0 +1,624 @@
+/*
+ * kmscon - Persistent Glyph Cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Persistent Glyph Cache
+ * The cache file starts with a header that contains a magic, the format
+ * version and the key of the face. It is followed by glyph records, each a
+ * small record-header plus the bitmap, which are only ever appended. Writers
+ * hold an exclusive flock() while appending and readers hold a shared lock
+ * while indexing, so nobody sees half-written records.
+ * Mappings are never moved or shrunk as glyphs handed out by
+ * kmscon_font_cache_find() point into them. New data is mapped separately.
+ * For the same reason, files of other versions or keys are never truncated
+ * as other processes may still have them mapped. Instead, a new file is
+ * written next to it and renamed over it, so the old one lives on until its
+ * last user closes it.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "font.h"
+#include "font_cache.h"
+#include "shl_dlist.h"
+#include "shl_hashtable.h"
+#include "shl_log.h"
+
+#define LOG_SUBSYSTEM "font_cache"
+
+#define CACHE_MAGIC "KMSGLYPH"
+#define CACHE_VERSION 1
+#define CACHE_KEY_MAX 256
+#define CACHE_MAX_SIZE (64 * 1024 * 1024)
+
+#define CACHE_ALIGN(x) (((x) + 7) & ~(size_t)7)
+
+struct cache_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t reserved;
+	char key[CACHE_KEY_MAX];
+};
+
+struct cache_record {
+	uint32_t key;
+	uint16_t cells;
+	uint16_t width;
+	uint16_t height;
+	uint16_t reserved;
+	uint32_t size;
+};
+
+struct cache_map {
+	struct shl_dlist list;
+	void *addr;
+	size_t len;
+};
+
+struct kmscon_font_cache {
+	pthread_mutex_t lock;
+	int fd;
+	bool writable;
+	bool broken;
+
+	/* all records before @end are indexed in @records */
+	off_t end;
+	struct shl_hashtable *records;
+	struct shl_dlist maps;
+};
+
+static uint64_t hash_key(const char *key)
+{
+	uint64_t hash = 14695981039346656037ULL;
+
+	while (*key) {
+		hash ^= (uint8_t)*key++;
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+static int get_dir(char **out)
+{
+	const char *env;
+	int ret;
+
+	env = getenv("XDG_CACHE_HOME");
+	if (env && *env) {
+		ret = asprintf(out, "%s/kmscon", env);
+	} else if (!geteuid()) {
+		ret = asprintf(out, "/var/cache/kmscon");
+	} else {
+		env = getenv("HOME");
+		if (!env || !*env)
+			return -ENOENT;
+		ret = asprintf(out, "%s/.cache/kmscon", env);
+	}
+
+	return ret < 0 ? -ENOMEM : 0;
+}
+
+static int make_dir(const char *dir)
+{
+	char *path, *p;
+	int ret = 0;
+
+	path = strdup(dir);
+	if (!path)
+		return -ENOMEM;
+
+	for (p = path + 1; *p; ++p) {
+		if (*p != '/')
+			continue;
+
+		*p = 0;
+		if (mkdir(path, 0755) < 0 && errno != EEXIST) {
+			ret = -errno;
+			goto out;
+		}
+		*p = '/';
+	}
+
+	if (mkdir(path, 0755) < 0 && errno != EEXIST)
+		ret = -errno;
+
+out:
+	free(path);
+	return ret;
+}
+
+/* indexes all records between cache->end and @size; called with a lock on the
+ * file held */
+static void scan(struct kmscon_font_cache *cache, off_t size)
+{
+	struct cache_map *map;
+	const struct cache_record *rec;
+	off_t base, off, next;
+	long page;
+	void *val;
+	int ret;
+
+	if (cache->broken || size <= cache->end)
+		return;
+
+	page = sysconf(_SC_PAGESIZE);
+	if (page <= 0)
+		page = 4096;
+	base = cache->end & ~(off_t)(page - 1);
+
+	map = malloc(sizeof(*map));
+	if (!map)
+		return;
+	map->len = size - base;
+	map->addr = mmap(NULL, map->len, PROT_READ, MAP_SHARED, cache->fd,
+			 base);
+	if (map->addr == MAP_FAILED) {
+		log_warning("cannot map glyph cache (%d): %m", errno);
+		free(map);
+		return;
+	}
+
+	off = cache->end;
+	while (off + (off_t)sizeof(*rec) <= size) {
+		rec = (void*)((uint8_t*)map->addr + (off - base));
+		next = off + sizeof(*rec) + rec->size;
+		if (!rec->cells || !rec->width || !rec->height ||
+		    rec->size != CACHE_ALIGN((size_t)rec->width * rec->height) ||
+		    next > size) {
+			log_warning("glyph cache is corrupted at offset %lld",
+				    (long long)off);
+			cache->broken = true;
+			break;
+		}
+
+		if (!shl_hashtable_find(cache->records, &val, rec->key)) {
+			ret = shl_hashtable_insert(cache->records, rec->key,
+						   (void*)rec);
+			if (ret)
+				break;
+		}
+
+		off = next;
+	}
+
+	if (off == cache->end) {
+		munmap(map->addr, map->len);
+		free(map);
+		return;
+	}
+
+	cache->end = off;
+	shl_dlist_link(&cache->maps, &map->list);
+}
+
+static void free_maps(struct kmscon_font_cache *cache)
+{
+	struct cache_map *map;
+
+	while (!shl_dlist_empty(&cache->maps)) {
+		map = shl_dlist_entry(cache->maps.next, struct cache_map, list);
+		shl_dlist_unlink(&map->list);
+		munmap(map->addr, map->len);
+		free(map);
+	}
+}
+
+static int write_header(int fd, const char *key)
+{
+	struct cache_header hdr;
+	ssize_t len;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, CACHE_MAGIC, sizeof(hdr.magic));
+	hdr.version = CACHE_VERSION;
+	strncpy(hdr.key, key, sizeof(hdr.key) - 1);
+
+	len = write(fd, &hdr, sizeof(hdr));
+	if (len != sizeof(hdr))
+		return len < 0 ? -errno : -EIO;
+
+	return 0;
+}
+
+/* Replaces the file at @path, which cache->fd is locked on, by an empty cache
+ * of @key. On success, cache->fd is the new file, locked exclusively. */
+static int replace_file(struct kmscon_font_cache *cache, const char *path,
+			const char *key)
+{
+	char *tmp;
+	int fd, ret;
+
+	ret = asprintf(&tmp, "%s.XXXXXX", path);
+	if (ret < 0)
+		return -ENOMEM;
+
+	fd = mkostemp(tmp, O_APPEND | O_CLOEXEC);
+	if (fd < 0) {
+		ret = -errno;
+		goto err_free;
+	}
+
+	if (fchmod(fd, 0644) < 0 || flock(fd, LOCK_EX) < 0) {
+		ret = -errno;
+		goto err_unlink;
+	}
+
+	ret = write_header(fd, key);
+	if (ret)
+		goto err_unlink;
+
+	if (rename(tmp, path) < 0) {
+		ret = -errno;
+		goto err_unlink;
+	}
+
+	free(tmp);
+	flock(cache->fd, LOCK_UN);
+	close(cache->fd);
+	cache->fd = fd;
+	return 0;
+
+err_unlink:
+	unlink(tmp);
+	close(fd);
+err_free:
+	free(tmp);
+	return ret;
+}
+
+/* true if @fd is still the file at @path, it may have been replaced while we
+ * waited for the lock */
+static bool is_current(int fd, const char *path)
+{
+	struct stat st1, st2;
+
+	return !fstat(fd, &st1) && !stat(path, &st2) &&
+	       st1.st_dev == st2.st_dev && st1.st_ino == st2.st_ino;
+}
+
+static bool check_header(struct kmscon_font_cache *cache, const char *key)
+{
+	struct cache_header hdr;
+	ssize_t len;
+
+	len = pread(cache->fd, &hdr, sizeof(hdr), 0);
+	if (len != sizeof(hdr))
+		return false;
+
+	return !memcmp(hdr.magic, CACHE_MAGIC, sizeof(hdr.magic)) &&
+	       hdr.version == CACHE_VERSION &&
+	       !strncmp(hdr.key, key, sizeof(hdr.key));
+}
+
+/**
+ * kmscon_font_cache_open:
+ * @out: Output storage for the new cache
+ * @dir: Directory of the cache files or NULL for the default
+ * @key: Unique identifier of the font face
+ *
+ * Opens the cache of the face @key and indexes all glyphs that are already
+ * stored in it. The default directory is $XDG_CACHE_HOME/kmscon, or
+ * /var/cache/kmscon for root. If the file cannot be written, it is used
+ * read-only. Files of other format versions or keys are replaced.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+int kmscon_font_cache_open(struct kmscon_font_cache **out, const char *dir,
+			   const char *key)
+{
+	struct kmscon_font_cache *cache;
+	char *path, *def = NULL;
+	struct stat st;
+	int ret;
+
+	if (!out || !key || strlen(key) >= CACHE_KEY_MAX)
+		return -EINVAL;
+
+	if (!dir) {
+		ret = get_dir(&def);
+		if (ret)
+			return ret;
+		dir = def;
+	}
+
+	cache = malloc(sizeof(*cache));
+	if (!cache) {
+		ret = -ENOMEM;
+		goto err_dir;
+	}
+	memset(cache, 0, sizeof(*cache));
+	shl_dlist_init(&cache->maps);
+
+	ret = shl_hashtable_new(&cache->records, shl_direct_hash,
+				shl_direct_equal, NULL);
+	if (ret)
+		goto err_free;
+
+	ret = make_dir(dir);
+	if (ret)
+		log_debug("cannot create glyph cache directory %s: %d", dir,
+			  ret);
+
+	ret = asprintf(&path, "%s/glyphs-%016" PRIx64 ".cache", dir,
+		       hash_key(key));
+	if (ret < 0) {
+		ret = -ENOMEM;
+		goto err_table;
+	}
+
+	while (true) {
+		cache->writable = true;
+		cache->fd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC,
+				 0644);
+		if (cache->fd < 0) {
+			cache->writable = false;
+			cache->fd = open(path, O_RDONLY | O_CLOEXEC);
+		}
+		if (cache->fd < 0) {
+			ret = -errno;
+			log_debug("cannot open glyph cache %s: %d", path, ret);
+			goto err_path;
+		}
+
+		if (flock(cache->fd, cache->writable ? LOCK_EX : LOCK_SH) < 0) {
+			ret = -errno;
+			goto err_fd;
+		}
+
+		if (is_current(cache->fd, path))
+			break;
+
+		flock(cache->fd, LOCK_UN);
+		close(cache->fd);
+	}
+
+	if (!check_header(cache, key)) {
+		if (!cache->writable) {
+			ret = -ENOENT;
+			goto err_unlock;
+		}
+
+		ret = replace_file(cache, path, key);
+		if (ret)
+			goto err_unlock;
+	}
+	free(path);
+	path = NULL;
+
+	if (fstat(cache->fd, &st) < 0) {
+		ret = -errno;
+		goto err_unlock;
+	}
+
+	cache->end = sizeof(struct cache_header);
+	scan(cache, st.st_size);
+
+	/* drop the tail of a writer that crashed while appending */
+	if (cache->broken && cache->writable &&
+	    !ftruncate(cache->fd, cache->end))
+		cache->broken = false;
+
+	flock(cache->fd, LOCK_UN);
+
+	ret = pthread_mutex_init(&cache->lock, NULL);
+	if (ret) {
+		ret = -ret;
+		goto err_maps;
+	}
+
+	log_debug("opened glyph cache %s (%lld bytes)", key,
+		  (long long)cache->end);
+	free(def);
+	*out = cache;
+	return 0;
+
+err_unlock:
+	flock(cache->fd, LOCK_UN);
+err_maps:
+	free_maps(cache);
+err_fd:
+	close(cache->fd);
+err_path:
+	free(path);
+err_table:
+	shl_hashtable_free(cache->records);
+err_free:
+	free(cache);
+err_dir:
+	free(def);
+	return ret;
+}
+
+/**
+ * kmscon_font_cache_close:
+ * @cache: Cache to close or NULL
+ *
+ * Closes @cache. All glyphs returned by kmscon_font_cache_find() become invalid.
+ */
+void kmscon_font_cache_close(struct kmscon_font_cache *cache)
+{
+	if (!cache)
+		return;
+
+	free_maps(cache);
+	pthread_mutex_destroy(&cache->lock);
+	shl_hashtable_free(cache->records);
+	close(cache->fd);
+	free(cache);
+}
+
+/**
+ * kmscon_font_cache_find:
+ * @cache: Valid cache
+ * @key: Key of the glyph
+ * @out: Glyph to fill in
+ *
+ * Looks up @key and sets @out->width and @out->buf. The bitmap points into the
+ * shared mapping of the cache file and is valid until @cache is closed. If the
+ * glyph is not known, the file is checked for glyphs that were added by other
+ * processes meanwhile.
+ *
+ * Returns: 0 on success, -ENOENT if the glyph is not cached
+ */
+int kmscon_font_cache_find(struct kmscon_font_cache *cache, uint32_t key,
+			   struct kmscon_glyph *out)
+{
+	const struct cache_record *rec;
+	struct stat st;
+	void *val;
+	bool res;
+
+	if (!cache || !out)
+		return -EINVAL;
+
+	pthread_mutex_lock(&cache->lock);
+
+	res = shl_hashtable_find(cache->records, &val, key);
+	if (!res && !cache->broken && !fstat(cache->fd, &st) &&
+	    st.st_size > cache->end) {
+		if (!flock(cache->fd, LOCK_SH)) {
+			scan(cache, st.st_size);
+			flock(cache->fd, LOCK_UN);
+		}
+		res = shl_hashtable_find(cache->records, &val, key);
+	}
+
+	pthread_mutex_unlock(&cache->lock);
+
+	if (!res)
+		return -ENOENT;
+
+	rec = val;
+	out->width = rec->cells;
+	out->buf.width = rec->width;
+	out->buf.height = rec->height;
+	out->buf.stride = rec->width;
+	out->buf.format = UTERM_FORMAT_GREY;
+	out->buf.data = (uint8_t*)(rec + 1);
+	return 0;
+}
+
+/**
+ * kmscon_font_cache_add:
+ * @cache: Valid cache
+ * @key: Key of the glyph
+ * @glyph: Rendered glyph
+ *
+ * Appends @glyph to the cache file so other processes and later runs can use
+ * it. @glyph itself is not indexed again; the caller is expected to keep it.
+ * Only greyscale glyphs are supported. The file is limited to 64MiB.
+ *
+ * Returns: 0 on success, negative error code on failure
+ */
+int kmscon_font_cache_add(struct kmscon_font_cache *cache, uint32_t key,
+			  const struct kmscon_glyph *glyph)
+{
+	const struct uterm_video_buffer *buf;
+	struct cache_record *rec;
+	struct stat st;
+	size_t size, len;
+	uint8_t *data, *dst;
+	unsigned int i;
+	ssize_t l;
+	int ret;
+
+	if (!cache || !glyph)
+		return -EINVAL;
+
+	buf = &glyph->buf;
+	if (buf->format != UTERM_FORMAT_GREY || !glyph->width ||
+	    glyph->width > UINT16_MAX || !buf->width ||
+	    buf->width > UINT16_MAX || !buf->height ||
+	    buf->height > UINT16_MAX)
+		return -EINVAL;
+	if (!cache->writable || cache->broken)
+		return -EROFS;
+
+	size = CACHE_ALIGN((size_t)buf->width * buf->height);
+	len = sizeof(*rec) + size;
+	data = malloc(len);
+	if (!data)
+		return -ENOMEM;
+	memset(data, 0, len);
+
+	rec = (void*)data;
+	rec->key = key;
+	rec->cells = glyph->width;
+	rec->width = buf->width;
+	rec->height = buf->height;
+	rec->size = size;
+
+	dst = (uint8_t*)(rec + 1);
+	for (i = 0; i < buf->height; ++i)
+		memcpy(&dst[i * buf->width], &buf->data[i * buf->stride],
+		       buf->width);
+
+	pthread_mutex_lock(&cache->lock);
+
+	if (flock(cache->fd, LOCK_EX) < 0) {
+		ret = -errno;
+		goto out_unlock;
+	}
+
+	if (fstat(cache->fd, &st) < 0) {
+		ret = -errno;
+		goto out_funlock;
+	}
+
+	if (st.st_size + len > CACHE_MAX_SIZE) {
+		ret = -ENOSPC;
+		goto out_funlock;
+	}
+
+	l = write(cache->fd, data, len);
+	if (l != (ssize_t)len) {
+		ret = l < 0 ? -errno : -EIO;
+		/* never leave partial records behind */
+		if (ftruncate(cache->fd, st.st_size) < 0)
+			cache->broken = true;
+		goto out_funlock;
+	}
+
+	ret = 0;
+
+out_funlock:
+	flock(cache->fd, LOCK_UN);
+out_unlock:
+	pthread_mutex_unlock(&cache->lock);
+	free(data);
+	return ret;
+}
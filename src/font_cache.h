@@ -0,0 +1,56 @@
+/*
+ * kmscon - Persistent Glyph Cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Persistent Glyph Cache
+ * Rendered glyphs of a single font face are stored in an append-only file so
+ * other processes (one kmscon instance per VT) and later runs can map them
+ * instead of rasterizing them again. The file is mapped read-only and shared,
+ * so all processes use the same pages of the page-cache. Glyphs that are added
+ * by other processes are picked up on the next miss.
+ * @key must identify everything that influences the rendered bitmaps (font,
+ * size, style and library versions). It is hashed into the file-name and
+ * stored in the header to detect collisions.
+ */
+
+#ifndef KMSCON_FONT_CACHE_H
+#define KMSCON_FONT_CACHE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "font.h"
+
+struct kmscon_font_cache;
+
+int kmscon_font_cache_open(struct kmscon_font_cache **out, const char *dir,
+			   const char *key);
+void kmscon_font_cache_close(struct kmscon_font_cache *cache);
+
+int kmscon_font_cache_find(struct kmscon_font_cache *cache, uint32_t key,
+			   struct kmscon_glyph *out);
+int kmscon_font_cache_add(struct kmscon_font_cache *cache, uint32_t key,
+			  const struct kmscon_glyph *glyph);
+
+#endif /* KMSCON_FONT_CACHE_H */
@@ -30,8 +30,9 @@
  * @include: font.h
  *
  * The pango backend uses pango and freetype2 to render glyphs into memory
- * buffers. It uses a hashmap to cache all rendered glyphs of a single
- * font-face. Therefore, rendering should be very fast. Also, when loading a
+ * buffers. It caches the rendered glyphs of a single font-face in an LRU cache
+ * that is bounded by kmscon_font_set_cache_budget(). Therefore, rendering
+ * should be very fast. Also, when loading a
  * glyph it pre-renders all common (mostly ASCII) characters, so it can measure
  * the font and return a valid font hight/width.
  *
@@ -49,10 +50,15 @@
 #include <pango/pango.h>
 #include <pango/pangoft2.h>
 #include <pthread.h>
+#include <signal.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "font.h"
+#include "font_cache.h"
+#include "shl_cache.h"
 #include "shl_dlist.h"
 #include "shl_hashtable.h"
 #include "shl_log.h"
@@ -68,8 +74,15 @@ struct face {
 	struct kmscon_font_attr real_attr;
 	unsigned int baseline;
 	PangoContext *ctx;
+	PangoFontDescription *desc;
 	pthread_mutex_t glyph_lock;
-	struct shl_hashtable *glyphs;
+	struct shl_cache *glyphs;
+	struct kmscon_font_cache *cache;
+
+	/* background rendering, see the worker pool below */
+	struct shl_hashtable *jobs;
+	struct kmscon_glyph *blank[2];
+	unsigned int busy;
 };
 
 static pthread_mutex_t manager_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -101,16 +114,85 @@ static int manager__ref()
 	return 0;
 }
 
+static void pool_stop(void);
+
 static void manager__unref()
 {
 	if (!--manager__refcnt) {
+		pool_stop();
 		g_object_unref(manager__lib);
 		manager__lib = NULL;
 	}
 }
 
-static int get_glyph(struct face *face, struct kmscon_glyph **out,
-		     uint64_t id, const uint32_t *ch, size_t len, const struct kmscon_font_attr *attr)
+/* Glyphs own their bitmap via glyph->data. It is NULL for glyphs that were
+ * loaded from the disk-cache as those point into its mapping. */
+static void free_glyph(void *data)
+{
+	struct kmscon_glyph *glyph = data;
+
+	free(glyph->data);
+	free(glyph);
+}
+
+/* called with face->glyph_lock held, frees @glyph on failure */
+static int cache_glyph(struct face *face, uint64_t id,
+		       struct kmscon_glyph *glyph)
+{
+	size_t size;
+	int ret;
+
+	size = sizeof(*glyph);
+	if (glyph->data)
+		size += glyph->buf.stride * glyph->buf.height;
+
+	ret = shl_cache_insert(face->glyphs, id, glyph, size);
+	if (ret) {
+		log_error("cannot add glyph to cache");
+		free_glyph(glyph);
+	}
+
+	return ret;
+}
+
+/* single code-points are stored in the disk-cache together with the style */
+#define CACHE_KEY(ch, style) ((ch) | \
+	(((style) & KMSCON_GLYPH_ITALIC) ? 1U << 29 : 0))
+
+static struct kmscon_glyph *load_glyph(struct face *face,
+				       const struct kmscon_glyph_req *req)
+{
+	struct kmscon_glyph *glyph;
+
+	if (!face->cache || req->len != 1)
+		return NULL;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return NULL;
+	memset(glyph, 0, sizeof(*glyph));
+
+	if (kmscon_font_cache_find(face->cache, CACHE_KEY(*req->ch, req->style),
+				   glyph)) {
+		free(glyph);
+		return NULL;
+	}
+
+	return glyph;
+}
+
+static void store_glyph(struct face *face, const uint32_t *ch, size_t len,
+			unsigned int style, const struct kmscon_glyph *glyph)
+{
+	if (face->cache && len == 1)
+		kmscon_font_cache_add(face->cache, CACHE_KEY(*ch, style), glyph);
+}
+
+/* rasterizes @ch with @ctx, which must be either face->ctx with the manager
+ * locked or a context of a worker's private font map */
+static int render_glyph(struct face *face, PangoContext *ctx,
+			struct kmscon_glyph **out, const uint32_t *ch,
+			size_t len, unsigned int cwidth, unsigned int style)
 {
 	struct kmscon_glyph *glyph;
 	PangoLayout *layout;
@@ -118,38 +200,19 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	PangoRectangle rec;
 	PangoLayoutLine *line;
 	FT_Bitmap bitmap;
-	unsigned int cwidth;
 	size_t ulen, cnt;
 	char *val;
-	bool res;
 	int ret;
 
-	if (!len)
-		return -ERANGE;
-	cwidth = tsm_ucs4_get_width(*ch);
-	if (!cwidth)
-		return -ERANGE;
-
-	pthread_mutex_lock(&face->glyph_lock);
-	res = shl_hashtable_find(face->glyphs, (void**)&glyph, id);
-	pthread_mutex_unlock(&face->glyph_lock);
-	if (res) {
-		*out = glyph;
-		return 0;
-	}
-
-	manager_lock();
-
 	glyph = malloc(sizeof(*glyph));
 	if (!glyph) {
 		log_error("cannot allocate memory for new glyph");
-		ret = -ENOMEM;
-		goto out_unlock;
+		return -ENOMEM;
 	}
 	memset(glyph, 0, sizeof(*glyph));
 	glyph->width = cwidth;
 
-	layout = pango_layout_new(face->ctx);
+	layout = pango_layout_new(ctx);
 	attrlist = pango_layout_get_attributes(layout);
 	if (attrlist == NULL) {
 		attrlist = pango_attr_list_new();
@@ -163,17 +226,8 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 	/* no line spacing */
 	pango_layout_set_spacing(layout, 0);
 
-	/* underline if requested */
-	if (attr->underline) {
-		pango_attr_list_change(attrlist,
-							   pango_attr_underline_new(PANGO_UNDERLINE_SINGLE));
-	} else {
-		pango_attr_list_change(attrlist,
-							   pango_attr_underline_new(PANGO_UNDERLINE_NONE));
-	}
-
 	/* italic if requested */
-	if (attr->italic) {
+	if (style & KMSCON_GLYPH_ITALIC) {
 		pango_attr_list_change(attrlist,
 							   pango_attr_style_new(PANGO_STYLE_ITALIC));
 	} else {
@@ -215,6 +269,7 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 		goto out_glyph;
 	}
 	memset(glyph->buf.data, 0, glyph->buf.height * glyph->buf.stride);
+	glyph->data = glyph->buf.data;
 
 	bitmap.rows = glyph->buf.height;
 	bitmap.width = glyph->buf.width;
@@ -225,34 +280,415 @@ static int get_glyph(struct face *face, struct kmscon_glyph **out,
 
 	pango_ft2_render_layout_line(&bitmap, line, -rec.x, face->baseline);
 
+	*out = glyph;
+	g_object_unref(layout);
+	return 0;
+
+out_glyph:
+	free(glyph);
+	g_object_unref(layout);
+	return ret;
+}
+
+/*
+ * Worker Pool
+ * Rasterizing a glyph that is not cached, yet, takes a considerable amount of
+ * time. If a page full of CJK text shows up, the event-loop would be blocked
+ * for hundreds of milliseconds. Therefore, cache-misses are queued on a small
+ * pool of worker threads if someone listens for kmscon_font_notify(). The
+ * caller gets a blank placeholder and -EAGAIN meanwhile.
+ * Neither pango nor freetype allow sharing a font-map between threads, so each
+ * worker creates its own map and a new context for each job. Jobs do not keep
+ * their face alive. Instead, manager_put_face() drops all queued jobs of a
+ * dying face and waits for the running ones.
+ */
+
+#define POOL_MAX_WORKERS 4
+
+struct job {
+	struct shl_dlist list;
+	struct face *face;
+	uint64_t id;
+	uint32_t *ch;
+	size_t len;
+	unsigned int cwidth;
+	unsigned int style;
+};
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_done_cond = PTHREAD_COND_INITIALIZER;
+static struct shl_dlist pool__queue = SHL_DLIST_INIT(pool__queue);
+static pthread_t pool__threads[POOL_MAX_WORKERS];
+static unsigned int pool__num;
+static bool pool__exit;
+
+static void free_job(void *data)
+{
+	struct job *job = data;
+
+	free(job->ch);
+	free(job);
+}
+
+/* allocates an empty glyph of @cwidth cells */
+static int new_blank(struct face *face, unsigned int cwidth,
+		     struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+	glyph->width = cwidth;
+	glyph->buf.width = face->real_attr.width * cwidth;
+	glyph->buf.height = face->real_attr.height;
+	glyph->buf.stride = glyph->buf.width;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+
+	glyph->buf.data = calloc(glyph->buf.height, glyph->buf.stride);
+	if (!glyph->buf.data) {
+		free(glyph);
+		return -ENOMEM;
+	}
+	glyph->data = glyph->buf.data;
+
+	*out = glyph;
+	return 0;
+}
+
+/*
+ * A job is removed from face->jobs once it ran. If the glyph cannot be
+ * rendered, the invalid-glyph is cached in its place, so it is neither
+ * retried on every redraw nor kept around as a job forever.
+ */
+static void run_job(PangoFontMap *map, struct job *job)
+{
+	static const uint32_t question_mark = '?';
+	struct face *face = job->face;
+	struct kmscon_glyph *glyph = NULL;
+	PangoContext *ctx;
+	int ret;
+
+	if (map) {
+		ctx = pango_font_map_create_context(map);
+		pango_context_set_base_dir(ctx, PANGO_DIRECTION_LTR);
+		pango_context_set_language(ctx, pango_language_get_default());
+		pango_context_set_font_description(ctx, face->desc);
+
+		ret = render_glyph(face, ctx, &glyph, job->ch, job->len,
+				   job->cwidth, job->style);
+		if (!ret)
+			store_glyph(face, job->ch, job->len, job->style,
+				    glyph);
+		else
+			ret = render_glyph(face, ctx, &glyph, &question_mark,
+					   1, job->cwidth, job->style);
+		g_object_unref(ctx);
+	} else {
+		ret = -EFAULT;
+	}
+
+	if (ret)
+		ret = new_blank(face, job->cwidth, &glyph);
+
 	pthread_mutex_lock(&face->glyph_lock);
-	ret = shl_hashtable_insert(face->glyphs, id, glyph);
+	shl_hashtable_remove(face->jobs, job->id);
+	if (!ret)
+		ret = cache_glyph(face, job->id, glyph);
 	pthread_mutex_unlock(&face->glyph_lock);
-	if (ret) {
-		log_error("cannot add glyph to hashtable");
-		goto out_buffer;
+
+	if (!ret)
+		kmscon_font_notify();
+}
+
+static void *pool_worker(void *data)
+{
+	PangoFontMap *map;
+	struct job *job;
+	struct face *face;
+
+	map = pango_ft2_font_map_new();
+
+	pthread_mutex_lock(&pool_mutex);
+	while (!pool__exit) {
+		if (shl_dlist_empty(&pool__queue)) {
+			pthread_cond_wait(&pool_cond, &pool_mutex);
+			continue;
+		}
+
+		job = shl_dlist_entry(pool__queue.next, struct job, list);
+		shl_dlist_unlink(&job->list);
+		face = job->face;
+		++face->busy;
+		pthread_mutex_unlock(&pool_mutex);
+
+		run_job(map, job);
+
+		pthread_mutex_lock(&pool_mutex);
+		if (!--face->busy)
+			pthread_cond_broadcast(&pool_done_cond);
+	}
+	pthread_mutex_unlock(&pool_mutex);
+
+	if (map)
+		g_object_unref(map);
+	return NULL;
+}
+
+/* called with the pool locked */
+static int pool__start(void)
+{
+	sigset_t all, old;
+	long num;
+	int ret = 0;
+
+	if (pool__num)
+		return 0;
+
+	num = sysconf(_SC_NPROCESSORS_ONLN);
+	if (num < 1)
+		num = 1;
+	else if (num > POOL_MAX_WORKERS)
+		num = POOL_MAX_WORKERS;
+
+	/* eloop blocks its signals only once registered, keep them off workers */
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+
+	for ( ; pool__num < num; ++pool__num) {
+		ret = pthread_create(&pool__threads[pool__num], NULL,
+				     pool_worker, NULL);
+		if (ret)
+			break;
+	}
+
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	if (!pool__num) {
+		log_warning("cannot start glyph workers (%d): %d", ret, errno);
+		return -EFAULT;
+	}
+
+	log_debug("started %u glyph workers", pool__num);
+	return 0;
+}
+
+/* called from manager__unref() once all faces are gone */
+static void pool_stop(void)
+{
+	unsigned int i, num;
+
+	pthread_mutex_lock(&pool_mutex);
+	pool__exit = true;
+	num = pool__num;
+	pthread_cond_broadcast(&pool_cond);
+	pthread_mutex_unlock(&pool_mutex);
+
+	for (i = 0; i < num; ++i)
+		pthread_join(pool__threads[i], NULL);
+
+	pthread_mutex_lock(&pool_mutex);
+	pool__num = 0;
+	pool__exit = false;
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+/* drops all queued jobs of @face and waits for the running ones */
+static void pool_cancel(struct face *face)
+{
+	struct shl_dlist *iter, *tmp;
+	struct job *job;
+
+	pthread_mutex_lock(&pool_mutex);
+	shl_dlist_for_each_safe(iter, tmp, &pool__queue) {
+		job = shl_dlist_entry(iter, struct job, list);
+		if (job->face == face)
+			shl_dlist_unlink(&job->list);
 	}
+	while (face->busy)
+		pthread_cond_wait(&pool_done_cond, &pool_mutex);
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+/* returns a blank glyph of @cwidth cells, called with face->glyph_lock held */
+static int get_blank(struct face *face, unsigned int cwidth,
+		     struct kmscon_glyph **out)
+{
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	if (cwidth > 2)
+		cwidth = 2;
 
+	if (face->blank[cwidth - 1]) {
+		*out = face->blank[cwidth - 1];
+		return 0;
+	}
+
+	ret = new_blank(face, cwidth, &glyph);
+	if (ret)
+		return ret;
+
+	face->blank[cwidth - 1] = glyph;
 	*out = glyph;
-	goto out_layout;
+	return 0;
+}
+
+/* Queues @ch on the worker pool. Returns -EAGAIN and a placeholder if the glyph
+ * is rendered in the background or 1 if the caller has to render the glyph
+ * synchronously. Called with face->glyph_lock held. */
+static int defer_glyph(struct face *face, struct kmscon_glyph **out,
+		       uint64_t id, const struct kmscon_glyph_req *req,
+		       unsigned int cwidth)
+{
+	struct job *job;
+	int ret;
+
+	if (!shl_hashtable_find(face->jobs, (void**)&job, id)) {
+		if (!kmscon_font_can_defer())
+			return 1;
+
+		pthread_mutex_lock(&pool_mutex);
+		ret = pool__start();
+		pthread_mutex_unlock(&pool_mutex);
+		if (ret)
+			return 1;
+
+		job = malloc(sizeof(*job));
+		if (!job)
+			return 1;
+		memset(job, 0, sizeof(*job));
+		job->face = face;
+		job->id = id;
+		job->len = req->len;
+		job->cwidth = cwidth;
+		job->style = req->style;
+
+		job->ch = malloc(sizeof(*req->ch) * req->len);
+		if (!job->ch) {
+			free(job);
+			return 1;
+		}
+		memcpy(job->ch, req->ch, sizeof(*req->ch) * req->len);
+
+		ret = shl_hashtable_insert(face->jobs, id, job);
+		if (ret) {
+			free_job(job);
+			return 1;
+		}
+
+		pthread_mutex_lock(&pool_mutex);
+		shl_dlist_link_tail(&pool__queue, &job->list);
+		pthread_cond_signal(&pool_cond);
+		pthread_mutex_unlock(&pool_mutex);
+	}
+
+	ret = get_blank(face, cwidth, out);
+	if (ret)
+		return ret;
+
+	return -EAGAIN;
+}
+
+static int get_glyph(struct face *face, struct kmscon_glyph **out,
+		     const struct kmscon_glyph_req *req, bool defer)
+{
+	struct kmscon_glyph *glyph;
+	unsigned int cwidth;
+	uint64_t id;
+	bool res;
+	int ret;
+
+	if (!req->len)
+		return -ERANGE;
+	cwidth = tsm_ucs4_get_width(*req->ch);
+	if (!cwidth)
+		return -ERANGE;
+
+	/* each style is cached separately */
+	id = KMSCON_GLYPH_KEY(req);
+
+	pthread_mutex_lock(&face->glyph_lock);
+	shl_cache_set_frame(face->glyphs, kmscon_font_get_frame());
+	res = shl_cache_find(face->glyphs, (void**)&glyph, id);
+	if (res) {
+		pthread_mutex_unlock(&face->glyph_lock);
+		*out = glyph;
+		return 0;
+	}
+
+	glyph = load_glyph(face, req);
+	if (glyph) {
+		ret = cache_glyph(face, id, glyph);
+		pthread_mutex_unlock(&face->glyph_lock);
+		if (ret)
+			return ret;
+
+		*out = glyph;
+		return 0;
+	}
+
+	if (defer) {
+		ret = defer_glyph(face, out, id, req, cwidth);
+		if (ret <= 0) {
+			pthread_mutex_unlock(&face->glyph_lock);
+			return ret;
+		}
+	}
+	pthread_mutex_unlock(&face->glyph_lock);
+
+	manager_lock();
+
+	ret = render_glyph(face, face->ctx, &glyph, req->ch, req->len, cwidth,
+			   req->style);
+	if (ret)
+		goto out_unlock;
+
+	store_glyph(face, req->ch, req->len, req->style, glyph);
+
+	/* a worker might have finished the same glyph meanwhile */
+	pthread_mutex_lock(&face->glyph_lock);
+	if (shl_cache_find(face->glyphs, (void**)out, id)) {
+		free_glyph(glyph);
+	} else {
+		ret = cache_glyph(face, id, glyph);
+		if (!ret)
+			*out = glyph;
+	}
+	pthread_mutex_unlock(&face->glyph_lock);
 
-out_buffer:
-	free(glyph->buf.data);
-out_glyph:
-	free(glyph);
-out_layout:
-	g_object_unref(layout);
 out_unlock:
 	manager_unlock();
 	return ret;
 }
 
-static void free_glyph(void *data)
+/* The disk-cache of a face is keyed by everything that affects the bitmaps,
+ * including the library versions, so updates never pick up stale glyphs. */
+static void open_cache(struct face *face)
 {
-	struct kmscon_glyph *glyph = data;
+	char *key;
+	int ret;
 
-	free(glyph->buf.data);
-	free(glyph);
+	ret = asprintf(&key, "%s %u %u %u %u %u %d %d pango-%s freetype-%d.%d.%d",
+		       face->real_attr.name, face->real_attr.ppi,
+		       face->real_attr.points, face->real_attr.width,
+		       face->real_attr.height, face->baseline,
+		       face->real_attr.bold, face->real_attr.italic,
+		       pango_version_string(), FREETYPE_MAJOR, FREETYPE_MINOR,
+		       FREETYPE_PATCH);
+	if (ret < 0)
+		return;
+
+	ret = kmscon_font_cache_open(&face->cache, NULL, key);
+	if (ret) {
+		log_debug("no glyph cache for font %s: %d",
+			  face->real_attr.name, ret);
+		face->cache = NULL;
+	}
+
+	free(key);
 }
 
 static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
@@ -297,13 +733,20 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		goto err_free;
 	}
 
-	ret = shl_hashtable_new(&face->glyphs, shl_direct_hash,
-				shl_direct_equal, free_glyph);
+	ret = shl_cache_new(&face->glyphs, kmscon_font_get_cache_budget(),
+			    free_glyph);
 	if (ret) {
-		log_error("cannot allocate hashtable");
+		log_error("cannot allocate glyph cache");
 		goto err_lock;
 	}
 
+	ret = shl_hashtable_new(&face->jobs, shl_direct_hash,
+				shl_direct_equal, free_job);
+	if (ret) {
+		log_error("cannot allocate hashtable");
+		goto err_glyphs;
+	}
+
 	face->ctx = pango_font_map_create_context(manager__lib);
 	pango_context_set_base_dir(face->ctx, PANGO_DIRECTION_LTR);
 	pango_context_set_language(face->ctx, pango_language_get_default());
@@ -319,7 +762,7 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 	pango_font_description_set_stretch(desc, PANGO_STRETCH_NORMAL);
 	pango_font_description_set_gravity(desc, PANGO_GRAVITY_SOUTH);
 	pango_context_set_font_description(face->ctx, desc);
-	pango_font_description_free(desc);
+	face->desc = desc;
 
 	/* measure font */
 	layout = pango_layout_new(face->ctx);
@@ -357,14 +800,18 @@ static int manager_get_face(struct face **out, struct kmscon_font_attr *attr)
 		}
 	}
 
+	open_cache(face);
 	shl_dlist_link(&manager__list, &face->list);
 	*out = face;
 	ret = 0;
 	goto out_unlock;
 
 err_face:
+	pango_font_description_free(face->desc);
 	g_object_unref(face->ctx);
-	shl_hashtable_free(face->glyphs);
+	shl_hashtable_free(face->jobs);
+err_glyphs:
+	shl_cache_free(face->glyphs);
 err_lock:
 	pthread_mutex_destroy(&face->glyph_lock);
 err_free:
@@ -378,12 +825,26 @@ out_unlock:
 
 static void manager_put_face(struct face *face)
 {
+	struct shl_cache_stats stats;
+
 	manager_lock();
 
 	if (!--face->ref) {
 		shl_dlist_unlink(&face->list);
-		shl_hashtable_free(face->glyphs);
+		pool_cancel(face);
+		shl_cache_get_stats(face->glyphs, &stats);
+		log_debug("glyph cache of %s: %lu hits, %lu misses, %lu evictions",
+			  face->real_attr.name, stats.hits, stats.misses,
+			  stats.evictions);
+		shl_hashtable_free(face->jobs);
+		shl_cache_free(face->glyphs);
+		if (face->blank[0])
+			free_glyph(face->blank[0]);
+		if (face->blank[1])
+			free_glyph(face->blank[1]);
+		kmscon_font_cache_close(face->cache);
 		pthread_mutex_destroy(&face->glyph_lock);
+		pango_font_description_free(face->desc);
 		g_object_unref(face->ctx);
 		free(face);
 		manager__unref();
@@ -422,34 +883,64 @@ static void kmscon_font_pango_destroy(struct kmscon_font *font)
 	manager_put_face(face);
 }
 
-static int kmscon_font_pango_render(struct kmscon_font *font, uint64_t id,
-				    const uint32_t *ch, size_t len,
+static int kmscon_font_pango_render(struct kmscon_font *font,
+				    const struct kmscon_glyph_req *req,
 				    const struct kmscon_glyph **out)
 {
 	struct kmscon_glyph *glyph;
 	int ret;
 
-	ret = get_glyph(font->data, &glyph, id, ch, len, &font->attr);
-	if (ret)
+	ret = get_glyph(font->data, &glyph, req, true);
+	if (ret && ret != -EAGAIN)
 		return ret;
 
 	*out = glyph;
-	return 0;
+	return ret;
 }
 
+/* the fallback glyphs are drawn instead of others, so they are never deferred */
 static int kmscon_font_pango_render_empty(struct kmscon_font *font,
+					  unsigned int style,
 					  const struct kmscon_glyph **out)
 {
 	static const uint32_t empty_char = ' ';
-	return kmscon_font_pango_render(font, empty_char, &empty_char, 1, out);
+	struct kmscon_glyph_req req = {
+		.id = empty_char,
+		.ch = &empty_char,
+		.len = 1,
+		.style = style,
+	};
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, &glyph, &req, false);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
 }
 
 static int kmscon_font_pango_render_inval(struct kmscon_font *font,
+					  unsigned int style,
 					  const struct kmscon_glyph **out)
 {
 	static const uint32_t question_mark = '?';
-	return kmscon_font_pango_render(font, question_mark, &question_mark, 1,
-					out);
+	struct kmscon_glyph_req req = {
+		.id = question_mark,
+		.ch = &question_mark,
+		.len = 1,
+		.style = style,
+	};
+	struct kmscon_glyph *glyph;
+	int ret;
+
+	ret = get_glyph(font->data, &glyph, &req, false);
+	if (ret)
+		return ret;
+
+	*out = glyph;
+	return 0;
 }
 
 struct kmscon_font_ops kmscon_font_pango_ops = {
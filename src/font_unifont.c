@@ -40,173 +40,288 @@
 
 #include <errno.h>
 #include <pthread.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include <libtsm.h>
 #include "font.h"
-#include "shl_hashtable.h"
 #include "shl_log.h"
 #include "uterm_video.h"
 #include "font_unifont_data.bin.h"
 
+#ifdef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+#include <zlib.h>
+#endif
+
 #define LOG_SUBSYSTEM "font_unifont"
 
 /*
- * Glyph data is linked to the binary externally as binary data. The data layout
- * is a size-byte followed by 32 data bytes. The data bytes are padded with 0 if
- * the size is smaller than 32.
- * Sizes bigger than 32 are not used.
+ * Glyph data is linked to the binary externally as binary data. It is split
+ * into pages of 256 codepoints and only pages with glyphs are stored, see
+ * genunifont.c for the exact layout. Each page starts with one width byte per
+ * codepoint, followed by the 1bpp bitmaps of its glyphs. Pages may be
+ * zlib-compressed; those are stored with a size that differs from their
+ * decompressed size.
  */
 
-struct unifont_data {
-	uint8_t len;
-	uint8_t data[32];
-} __attribute__((__packed__));
+#define UNIFONT_MAX 0x10ffff
+#define UNIFONT_PAGE_SHIFT 8
+#define UNIFONT_PAGE_SIZE (1U << UNIFONT_PAGE_SHIFT)
+#define UNIFONT_PAGE_NUM ((UNIFONT_MAX >> UNIFONT_PAGE_SHIFT) + 1)
+#define UNIFONT_HEADER_SIZE 8
+#define UNIFONT_INDEX_SIZE 16
 
-/*
- * Global glyph cache
- * The linked binary glyph data cannot be directly passed to the caller as it
- * has the wrong format. Hence, use a glyph-cache with all used glyphs and add
- * new ones as soon as they are used.
- */
+static uint32_t get_le32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
 
-static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
-static struct shl_hashtable *cache;
-static unsigned long cache_refnum;
+static const uint8_t *get_data(void)
+{
+	return (const uint8_t*)_binary_font_unifont_data_start;
+}
 
-static void cache_ref(void)
+static size_t get_data_size(void)
 {
-	pthread_mutex_lock(&cache_mutex);
-	++cache_refnum;
-	pthread_mutex_unlock(&cache_mutex);
+	return _binary_font_unifont_data_end - _binary_font_unifont_data_start;
 }
 
-static void cache_unref(void)
+static uint32_t get_page_num(void)
 {
-	pthread_mutex_lock(&cache_mutex);
-	if (!--cache_refnum) {
-		shl_hashtable_free(cache);
-		cache = NULL;
+	return get_le32(&get_data()[4]);
+}
+
+/* returns the index entry of page @idx or NULL if the page has no glyphs */
+static const uint8_t *find_block(uint32_t idx)
+{
+	const uint8_t *index, *e;
+	uint32_t lo, hi, mid, page;
+
+	index = &get_data()[UNIFONT_HEADER_SIZE];
+	lo = 0;
+	hi = get_page_num();
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		e = &index[mid * UNIFONT_INDEX_SIZE];
+		page = get_le32(e);
+		if (page == idx)
+			return e;
+		else if (page < idx)
+			lo = mid + 1;
+		else
+			hi = mid;
 	}
-	pthread_mutex_unlock(&cache_mutex);
+
+	return NULL;
 }
 
-static void free_glyph(void *data)
+/* verify the header and the index once so page lookups can trust them */
+static int check_data(void)
 {
-	struct kmscon_glyph *g = data;
+	const uint8_t *data = get_data(), *e;
+	size_t size = get_data_size();
+	uint32_t i, num, offset, len, raw_len;
+
+	if (size < UNIFONT_HEADER_SIZE || memcmp(data, "UNIF", 4))
+		return -EFAULT;
 
-	free(g->buf.data);
-	free(g);
+	num = get_page_num();
+	if (num > (size - UNIFONT_HEADER_SIZE) / UNIFONT_INDEX_SIZE)
+		return -EFAULT;
+
+	for (i = 0; i < num; ++i) {
+		e = &data[UNIFONT_HEADER_SIZE + i * UNIFONT_INDEX_SIZE];
+		offset = get_le32(&e[4]);
+		len = get_le32(&e[8]);
+		raw_len = get_le32(&e[12]);
+
+		if (offset > size || len > size - offset)
+			return -EFAULT;
+		if (raw_len < UNIFONT_PAGE_SIZE)
+			return -EFAULT;
+		if (i && get_le32(e) <= get_le32(&e[-UNIFONT_INDEX_SIZE]))
+			return -EFAULT;
+#ifndef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+		if (len != raw_len) {
+			log_error("unifont data is compressed but zlib support is disabled");
+			return -EOPNOTSUPP;
+		}
+#endif
+	}
+
+	return 0;
 }
 
-static void unfold(uint8_t *dst, uint8_t val)
+/*
+ * Global glyph table
+ * Uncompressed pages are already in UTERM_FORMAT_MONO layout, so their glyphs
+ * point directly into the linked data; compressed pages are inflated into a
+ * buffer owned by the page. Either way, only the glyph descriptions are
+ * allocated. They are kept in a two-level table indexed by codepoint: the upper
+ * bits select a page of UNIFONT_PAGE_SIZE glyphs which is filled in one go the
+ * first time any of its codepoints is drawn. Pages are published with an
+ * atomic compare-and-swap, so lookups never take a lock; if two threads race
+ * to create the same page, the loser frees its copy. Pages without any glyphs
+ * all share a static empty page.
+ * The table is shared by all unifont fonts and freed with the last one.
+ */
+
+struct unifont_page {
+	struct kmscon_glyph glyphs[UNIFONT_PAGE_SIZE];
+	uint8_t *data;
+};
+
+static pthread_mutex_t table_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct unifont_page *table[UNIFONT_PAGE_NUM];
+static struct unifont_page empty_page;
+static unsigned long table_refnum;
+
+static void free_page(struct unifont_page *page)
 {
-	*dst = 0xff * !!val;
+	if (!page || page == &empty_page)
+		return;
+
+	free(page->data);
+	free(page);
 }
 
-static int find_glyph(uint32_t ch, const struct kmscon_glyph **out)
+static void table_ref(void)
 {
-	struct kmscon_glyph *g;
-	int ret;
-	bool res;
-	const struct unifont_data *start, *end, *d;
-	unsigned int i, w;
+	pthread_mutex_lock(&table_mutex);
+	++table_refnum;
+	pthread_mutex_unlock(&table_mutex);
+}
 
-	pthread_mutex_lock(&cache_mutex);
+static void table_unref(void)
+{
+	unsigned int i;
 
-	if (!cache) {
-		ret = shl_hashtable_new(&cache, shl_direct_hash,
-					shl_direct_equal, free_glyph);
-		if (ret) {
-			log_error("cannot create unifont hashtable: %d", ret);
-			goto out_unlock;
+	pthread_mutex_lock(&table_mutex);
+	if (!--table_refnum) {
+		for (i = 0; i < UNIFONT_PAGE_NUM; ++i) {
+			free_page(table[i]);
+			table[i] = NULL;
 		}
-	} else {
-		res = shl_hashtable_find(cache, (void**)out, ch);
-		if (res) {
-			ret = 0;
-			goto out_unlock;
+	}
+	pthread_mutex_unlock(&table_mutex);
+}
+
+static int load_page(struct unifont_page *page, const uint8_t *block)
+{
+	const uint8_t *raw;
+	uint32_t offset, len, raw_len, pos, i, w;
+	struct kmscon_glyph *g;
+
+	offset = get_le32(&block[4]);
+	len = get_le32(&block[8]);
+	raw_len = get_le32(&block[12]);
+	raw = &get_data()[offset];
+
+	if (len != raw_len) {
+#ifdef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+		uLongf size = raw_len;
+		int ret;
+
+		page->data = malloc(raw_len);
+		if (!page->data)
+			return -ENOMEM;
+
+		ret = uncompress(page->data, &size, raw, len);
+		if (ret != Z_OK || size != raw_len) {
+			log_error("cannot inflate unifont page %x: %d",
+				  get_le32(block), ret);
+			return -EFAULT;
 		}
+		raw = page->data;
+#else
+		return -EOPNOTSUPP;
+#endif
 	}
 
-	if (ch > 0xffff) {
-		ret = -ERANGE;
-		goto out_unlock;
+	pos = UNIFONT_PAGE_SIZE;
+	for (i = 0; i < UNIFONT_PAGE_SIZE; ++i) {
+		w = raw[i];
+		if (!w)
+			continue;
+		if (w > 2 || raw_len - pos < w * 16)
+			return -EFAULT;
+
+		g = &page->glyphs[i];
+		g->width = w;
+		g->buf.width = w * 8;
+		g->buf.height = 16;
+		g->buf.stride = w;
+		g->buf.format = UTERM_FORMAT_MONO;
+		g->buf.data = (uint8_t*)&raw[pos];
+		pos += w * 16;
 	}
 
-	start = (const struct unifont_data*)_binary_font_unifont_data_start;
-	end = (const struct unifont_data*)_binary_font_unifont_data_end;
-	d = &start[ch];
+	return 0;
+}
 
-	if (d >= end) {
-		ret = -ERANGE;
-		goto out_unlock;
-	}
+static int new_page(uint32_t idx, struct unifont_page **out)
+{
+	struct unifont_page *page, *prev;
+	const uint8_t *block;
+	int ret;
 
-	switch (d->len) {
-	case 16:
-		w = 1;
-		break;
-	case 32:
-		w = 2;
-		break;
-	default:
-		ret = -EFAULT;
-		goto out_unlock;
-	}
+	block = find_block(idx);
+	if (!block) {
+		page = &empty_page;
+	} else {
+		page = malloc(sizeof(*page));
+		if (!page)
+			return -ENOMEM;
+		memset(page, 0, sizeof(*page));
 
-	g = malloc(sizeof(*g));
-	if (!g) {
-		ret = -ENOMEM;
-		goto out_unlock;
-	}
-	memset(g, 0, sizeof(*g));
-	g->width = w;
-	g->buf.width = w * 8;
-	g->buf.height = 16;
-	g->buf.stride = w * 8;
-	g->buf.format = UTERM_FORMAT_GREY;
-
-	g->buf.data = malloc(g->buf.stride * g->buf.height);
-	if (!g->buf.data) {
-		ret = -ENOMEM;
-		goto err_free;
+		ret = load_page(page, block);
+		if (ret) {
+			free_page(page);
+			return ret;
+		}
 	}
 
-	for (i = 0; i < d->len; ++i) {
-		unfold(&g->buf.data[i * 8 + 0], d->data[i] & 0x80);
-		unfold(&g->buf.data[i * 8 + 1], d->data[i] & 0x40);
-		unfold(&g->buf.data[i * 8 + 2], d->data[i] & 0x20);
-		unfold(&g->buf.data[i * 8 + 3], d->data[i] & 0x10);
-		unfold(&g->buf.data[i * 8 + 4], d->data[i] & 0x08);
-		unfold(&g->buf.data[i * 8 + 5], d->data[i] & 0x04);
-		unfold(&g->buf.data[i * 8 + 6], d->data[i] & 0x02);
-		unfold(&g->buf.data[i * 8 + 7], d->data[i] & 0x01);
+	prev = NULL;
+	if (!__atomic_compare_exchange_n(&table[idx], &prev, page, false,
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		free_page(page);
+		page = prev;
 	}
 
-	ret = shl_hashtable_insert(cache, ch, g);
-	if (ret) {
-		log_error("cannot insert glyph into glyph-cache: %d", ret);
-		goto err_data;
+	*out = page;
+	return 0;
+}
+
+static int find_glyph(uint32_t ch, const struct kmscon_glyph **out)
+{
+	struct unifont_page *page;
+	const struct kmscon_glyph *g;
+	int ret;
+
+	if (ch > UNIFONT_MAX)
+		return -ERANGE;
+
+	page = __atomic_load_n(&table[ch >> UNIFONT_PAGE_SHIFT],
+			       __ATOMIC_ACQUIRE);
+	if (!page) {
+		ret = new_page(ch >> UNIFONT_PAGE_SHIFT, &page);
+		if (ret)
+			return ret;
 	}
 
+	g = &page->glyphs[ch & (UNIFONT_PAGE_SIZE - 1)];
+	if (!g->width)
+		return -ERANGE;
+
 	*out = g;
-	ret = 0;
-	goto out_unlock;
-
-err_data:
-	free(g->buf.data);
-err_free:
-	free(g);
-out_unlock:
-	pthread_mutex_unlock(&cache_mutex);
-	return ret;
+	return 0;
 }
 
 static int kmscon_font_unifont_init(struct kmscon_font *out,
 				    const struct kmscon_font_attr *attr)
 {
 	static const char name[] = "static-unifont";
+	int ret;
 
 	log_debug("loading static unifont font");
 
@@ -215,6 +330,12 @@ static int kmscon_font_unifont_init(struct kmscon_font *out,
 		return -EFAULT;
 	}
 
+	ret = check_data();
+	if (ret) {
+		log_error("invalid unifont glyph information in binary");
+		return ret;
+	}
+
 
 	memset(&out->attr, 0, sizeof(out->attr));
 	memcpy(out->attr.name, name, sizeof(name));
@@ -223,35 +344,37 @@ static int kmscon_font_unifont_init(struct kmscon_font *out,
 	out->attr.width = 8;
 	out->attr.height = 16;
 	kmscon_font_attr_normalize(&out->attr);
-	out->baseline = 4;
+	out->baseline = 14;
 
-	cache_ref();
+	table_ref();
 	return 0;
 }
 
 static void kmscon_font_unifont_destroy(struct kmscon_font *font)
 {
 	log_debug("unloading static unifont font");
-	cache_unref();
+	table_unref();
 }
 
-static int kmscon_font_unifont_render(struct kmscon_font *font, uint64_t id,
-				      const uint32_t *ch, size_t len,
+static int kmscon_font_unifont_render(struct kmscon_font *font,
+				      const struct kmscon_glyph_req *req,
 				      const struct kmscon_glyph **out)
 {
-	if (len > 1)
+	if (req->len > 1)
 		return -ERANGE;
 
-	return find_glyph(id & TSM_UCS4_MAX, out);
+	return find_glyph(req->id & TSM_UCS4_MAX, out);
 }
 
 static int kmscon_font_unifont_render_inval(struct kmscon_font *font,
+					    unsigned int style,
 					    const struct kmscon_glyph **out)
 {
 	return find_glyph(0xfffd, out);
 }
 
 static int kmscon_font_unifont_render_empty(struct kmscon_font *font,
+					    unsigned int style,
 					    const struct kmscon_glyph **out)
 {
 	return find_glyph(' ', out);
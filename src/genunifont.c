@@ -26,17 +26,44 @@
 
 /*
  * Unifont Generator
- * This converts the hex-encoded Unifont data into a C-array that is used by the
- * unifont-font-renderer.
+ * This converts the hex-encoded Unifont data into the binary font data that is
+ * linked into the unifont-font-renderer. Any number of hex files can be given,
+ * so additional planes (like unifont_upper) can simply be appended.
+ *
+ * Codepoints are grouped into pages of 256. Only pages that contain glyphs are
+ * stored, and each page only stores the glyphs it has, so unassigned ranges
+ * cost nothing. All integers are little-endian 32bit values:
+ *
+ *   header:     "UNIF" page_num
+ *   index:      page_num times: page offset size raw_size
+ *   page data:  one block per page at @offset with @size bytes
+ *
+ * @page is the codepoint shifted right by 8, the index is sorted by it.
+ * Decompressed, a page block is 256 width bytes (0 if there is no glyph, 1 for
+ * 8x16 and 2 for 16x16 glyphs), followed by the 1bpp bitmaps of all its glyphs
+ * in codepoint order, 16 rows of width bytes each. If --compress is given,
+ * blocks are zlib-compressed unless that does not make them smaller. A block
+ * is stored uncompressed if and only if @size equals @raw_size.
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+#include <zlib.h>
+#endif
+
 #define MAX_DATA_SIZE 255
+#define MAX_CODEPOINT 0x10ffff
+
+#define PAGE_SHIFT 8
+#define PAGE_SIZE (1U << PAGE_SHIFT)
+#define HEADER_SIZE 8
+#define INDEX_SIZE 16
 
 struct unifont_glyph {
 	struct unifont_glyph *next;
@@ -45,6 +72,14 @@ struct unifont_glyph {
 	char data[MAX_DATA_SIZE];
 };
 
+struct unifont_page {
+	uint32_t page;
+	uint32_t offset;
+	uint32_t size;
+	uint32_t raw_size;
+	uint8_t *data;
+};
+
 static uint8_t hex_val(char c)
 {
 	if (c >= '0' && c <= '9')
@@ -58,31 +93,6 @@ static uint8_t hex_val(char c)
 	return 0;
 }
 
-static void print_unifont_glyph(FILE *out, const struct unifont_glyph *g)
-{
-	size_t i;
-	uint8_t val;
-
-	switch (g->len) {
-	case 32:
-	case 64:
-		break;
-	default:
-		fprintf(stderr, "genunifont: invalid data size %d for %x",
-			g->len, g->codepoint);
-		return;
-	}
-
-	fprintf(out, "%c", g->len / 2);
-	for (i = 0; i < g->len; i += 2) {
-		val = hex_val(g->data[i]) << 4;
-		val |= hex_val(g->data[i + 1]);
-		fprintf(out, "%c", val);
-	}
-	for ( ; i < 64; i += 2)
-		fprintf(out, "%c", 0);
-}
-
 static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 {
 	int val;
@@ -99,6 +109,11 @@ static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 		return -EFAULT;
 	}
 
+	if (val > MAX_CODEPOINT) {
+		fprintf(stderr, "genunifont: invalid codepoint %x\n", val);
+		return -EFAULT;
+	}
+
 	g->codepoint = val;
 	g->len = 0;
 	while (*buf && *buf != '\n' && g->len < MAX_DATA_SIZE) {
@@ -106,19 +121,24 @@ static int build_unifont_glyph(struct unifont_glyph *g, const char *buf)
 		++g->len;
 	}
 
+	switch (g->len) {
+	case 32:
+	case 64:
+		break;
+	default:
+		fprintf(stderr, "genunifont: invalid data size %d for %x\n",
+			g->len, g->codepoint);
+		return -EFAULT;
+	}
+
 	return 0;
 }
 
-static int parse_single_file(FILE *out, FILE *in)
+static int parse_single_file(struct unifont_glyph **list, FILE *in)
 {
-	static const struct unifont_glyph replacement = {
-		.codepoint = 0,
-		.len = 32,
-		.data = "0000007E665A5A7A76767E76767E0000"
-	};
 	char buf[MAX_DATA_SIZE];
-	struct unifont_glyph *g, **iter, *list, *last;
-	int ret, num;
+	struct unifont_glyph *g, **iter, *last;
+	int ret;
 	long status_max, status_cur;
 	unsigned long perc_prev, perc_now;
 
@@ -139,7 +159,6 @@ static int parse_single_file(FILE *out, FILE *in)
 	}
 
 	rewind(in);
-	list = NULL;
 	last = NULL;
 	status_cur = 0;
 	perc_prev = 0;
@@ -180,16 +199,16 @@ static int parse_single_file(FILE *out, FILE *in)
 		if (last && last->codepoint < g->codepoint) {
 			iter = &last->next;
 		} else {
-			iter = &list;
+			iter = list;
 			while (*iter && (*iter)->codepoint < g->codepoint)
 				iter = &(*iter)->next;
+		}
 
-			if (*iter && (*iter)->codepoint == g->codepoint) {
-				fprintf(stderr, "glyph %d used twice\n",
-					g->codepoint);
-				free(g);
-				return -EFAULT;
-			}
+		if (*iter && (*iter)->codepoint == g->codepoint) {
+			fprintf(stderr, "glyph %d used twice\n",
+				g->codepoint);
+			free(g);
+			return -EFAULT;
 		}
 
 		/* insert glyph into single-linked list */
@@ -201,61 +220,222 @@ static int parse_single_file(FILE *out, FILE *in)
 
 	fprintf(stderr, "\b\b\b\b%3d%%\n", 100);
 
-	/* print all glyph-data to output file */
-	num = 0;
-	while (list) {
-		g = list;
-		list = g->next;
+	return 0;
+}
 
-		/* print replacements if glyphs are missing */
-		while (num++ < g->codepoint)
-			print_unifont_glyph(out, &replacement);
+/*
+ * Build the block of the page of the first glyph in @list and advance @list to
+ * the first glyph of the next page.
+ */
+static int build_page(struct unifont_page *p, struct unifont_glyph **list,
+		      bool compress)
+{
+	struct unifont_glyph *g;
+	uint8_t *raw, *pos;
+	size_t i;
+	int ret;
 
-		print_unifont_glyph(out, g);
-		free(g);
+	p->page = (*list)->codepoint >> PAGE_SHIFT;
+	p->raw_size = PAGE_SIZE;
+	for (g = *list; g && g->codepoint >> PAGE_SHIFT == p->page; g = g->next)
+		p->raw_size += g->len / 2;
+
+	raw = malloc(p->raw_size);
+	if (!raw) {
+		fprintf(stderr, "genunifont: out of memory\n");
+		return -ENOMEM;
+	}
+	memset(raw, 0, PAGE_SIZE);
+
+	pos = &raw[PAGE_SIZE];
+	for (g = *list; g && g->codepoint >> PAGE_SHIFT == p->page; g = g->next) {
+		raw[g->codepoint & (PAGE_SIZE - 1)] = g->len / 32;
+		for (i = 0; i < g->len; i += 2)
+			*pos++ = hex_val(g->data[i]) << 4 |
+				 hex_val(g->data[i + 1]);
+	}
+
+	p->data = raw;
+	p->size = p->raw_size;
+	*list = g;
+
+#ifdef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+	if (compress) {
+		uLongf len = compressBound(p->raw_size);
+		uint8_t *z;
+
+		z = malloc(len);
+		if (!z) {
+			fprintf(stderr, "genunifont: out of memory\n");
+			return -ENOMEM;
+		}
+
+		ret = compress2(z, &len, raw, p->raw_size, 9);
+		if (ret != Z_OK) {
+			fprintf(stderr, "genunifont: cannot compress page %x: %d\n",
+				p->page, ret);
+			free(z);
+			return -EFAULT;
+		}
+
+		if (len < p->raw_size) {
+			free(raw);
+			p->data = z;
+			p->size = len;
+		} else {
+			free(z);
+		}
 	}
+#else
+	(void)ret;
+	(void)compress;
+#endif
 
 	return 0;
 }
 
+static int write_le32(FILE *out, uint32_t val)
+{
+	uint8_t buf[4];
+
+	buf[0] = val;
+	buf[1] = val >> 8;
+	buf[2] = val >> 16;
+	buf[3] = val >> 24;
+
+	if (fwrite(buf, 1, sizeof(buf), out) != sizeof(buf))
+		return -EFAULT;
+	return 0;
+}
+
+static int write_font(FILE *out, struct unifont_glyph *list, bool compress)
+{
+	struct unifont_glyph *g;
+	struct unifont_page *pages;
+	size_t num, i;
+	uint32_t offset, page;
+	int ret = 0;
+
+	num = 0;
+	page = -1;
+	for (g = list; g; g = g->next) {
+		if (g->codepoint >> PAGE_SHIFT != page) {
+			page = g->codepoint >> PAGE_SHIFT;
+			++num;
+		}
+	}
+
+	pages = calloc(num ? num : 1, sizeof(*pages));
+	if (!pages) {
+		fprintf(stderr, "genunifont: out of memory\n");
+		return -ENOMEM;
+	}
+
+	offset = HEADER_SIZE + num * INDEX_SIZE;
+	for (i = 0, g = list; i < num; ++i) {
+		ret = build_page(&pages[i], &g, compress);
+		if (ret)
+			goto out_free;
+		pages[i].offset = offset;
+		offset += pages[i].size;
+	}
+
+	if (fwrite("UNIF", 1, 4, out) != 4 || write_le32(out, num)) {
+		ret = -EFAULT;
+		goto out_write;
+	}
+
+	for (i = 0; i < num; ++i) {
+		if (write_le32(out, pages[i].page) ||
+		    write_le32(out, pages[i].offset) ||
+		    write_le32(out, pages[i].size) ||
+		    write_le32(out, pages[i].raw_size)) {
+			ret = -EFAULT;
+			goto out_write;
+		}
+	}
+
+	for (i = 0; i < num; ++i) {
+		if (fwrite(pages[i].data, 1, pages[i].size, out) !=
+		    pages[i].size) {
+			ret = -EFAULT;
+			goto out_write;
+		}
+	}
+
+	fprintf(stderr, "genunifont: %zu pages, %u bytes\n", num, offset);
+
+out_write:
+	if (ret)
+		fprintf(stderr, "genunifont: cannot write output: %m\n");
+out_free:
+	for (i = 0; i < num; ++i)
+		free(pages[i].data);
+	free(pages);
+	return ret;
+}
+
 int main(int argc, char **argv)
 {
 	FILE *out, *in;
-	int ret;
+	struct unifont_glyph *list = NULL, *g;
+	bool compress = false;
+	int ret, i = 1;
+
+	if (argc > 1 && !strcmp(argv[1], "--compress")) {
+#ifdef BUILD_ENABLE_FONT_UNIFONT_COMPRESS
+		compress = true;
+		++i;
+#else
+		fprintf(stderr, "genunifont: compression not supported\n");
+		return EXIT_FAILURE;
+#endif
+	}
 
-	if (argc < 3) {
-		fprintf(stderr, "genunifont: use ./genunifont <outputfile> <inputfiles>\n");
-		ret = EXIT_FAILURE;
-		goto err_out;
+	if (argc < i + 2) {
+		fprintf(stderr, "genunifont: use ./genunifont [--compress] <outputfile> <inputfiles>\n");
+		return EXIT_FAILURE;
 	}
 
-	out = fopen(argv[1], "wb");
-	if (!out) {
-		fprintf(stderr, "genunifont: cannot open output %s: %m\n",
-			argv[1]);
-		ret = EXIT_FAILURE;
-		goto err_out;
+	ret = EXIT_SUCCESS;
+	for (++i; i < argc; ++i) {
+		in = fopen(argv[i], "rb");
+		if (!in) {
+			fprintf(stderr, "genunifont: cannot open %s: %m\n",
+				argv[i]);
+			ret = EXIT_FAILURE;
+			break;
+		}
+
+		if (parse_single_file(&list, in)) {
+			fprintf(stderr, "genunifont: parsing input %s failed\n",
+				argv[i]);
+			ret = EXIT_FAILURE;
+		}
+		fclose(in);
+		if (ret)
+			break;
 	}
 
-	in = fopen(argv[2], "rb");
-	if (!in) {
-		fprintf(stderr, "genunifont: cannot open %s: %m\n",
-			argv[2]);
-		ret = EXIT_FAILURE;
-	} else {
-		ret = parse_single_file(out, in);
-		if (ret) {
-			fprintf(stderr, "genunifont: parsing input %s failed",
-				argv[2]);
+	if (ret == EXIT_SUCCESS) {
+		out = fopen(argv[compress ? 2 : 1], "wb");
+		if (!out) {
+			fprintf(stderr, "genunifont: cannot open output %s: %m\n",
+				argv[compress ? 2 : 1]);
 			ret = EXIT_FAILURE;
 		} else {
-			ret = EXIT_SUCCESS;
+			if (write_font(out, list, compress))
+				ret = EXIT_FAILURE;
+			if (fclose(out))
+				ret = EXIT_FAILURE;
 		}
-		fclose(in);
 	}
 
+	while (list) {
+		g = list;
+		list = g->next;
+		free(g);
+	}
 
-	fclose(out);
-err_out:
 	return ret;
 }
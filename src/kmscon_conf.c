@@ -146,6 +146,15 @@ static void print_help()
 		"\t    --gpus={all,aux,primary}[all]    GPU selection mode\n"
 		"\t    --render-engine <eng>   [-]      Console renderer\n"
 		"\t    --render-timing         [off]    Print renderer timing information\n"
+		"\t    --shadow-buffer         [off]    Render into system memory and copy\n"
+		"\t                                     changes to video memory on swap\n"
+		"\t    --atlas-budget <MiB>    [64]     Video memory for glyph atlases of\n"
+		"\t                                     the gltex renderer, 0 is unlimited\n"
+		"\t    --tile-cache <MiB>      [4]      Memory for blended glyphs of the\n"
+		"\t                                     drm2d and fbdev backends, 0 disables\n"
+		"\t                                     the cache\n"
+		"\t    --render-threads <num>  [0]      Threads of the drm2d and fbdev\n"
+		"\t                                     backends, 0 is one per CPU\n"
 		"\t    --rotate <orientation>  [normal] normal, right, inverted, left\n"
 		"\n"
 		"Font Options:\n"
@@ -157,6 +166,9 @@ static void print_help()
 		"\t                              Font name\n"
 		"\t    --font-dpi <dpi>        [96]\n"
 		"\t                              Force DPI value for all fonts\n"
+		"\t    --glyph-cache <MiB>     [8]\n"
+		"\t                              Memory for rendered glyphs of each font\n"
+		"\t                              and text renderer, 0 is unlimited\n"
 		"\n"
 		"Palette Options:\n"
 		"\t    --palette <name>                [default]\n"
@@ -747,6 +759,10 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_BOOL(0, "hwaccel", &conf->hwaccel, false),
 		CONF_OPTION(0, 0, "gpus", &conf_gpus, NULL, NULL, NULL, &conf->gpus, KMSCON_GPU_ALL),
 		CONF_OPTION_STRING(0, "render-engine", &conf->render_engine, NULL),
+		CONF_OPTION_BOOL(0, "shadow-buffer", &conf->shadow_buffer, false),
+		CONF_OPTION_UINT(0, "atlas-budget", &conf->atlas_budget, 64),
+		CONF_OPTION_UINT(0, "tile-cache", &conf->tile_cache, 4),
+		CONF_OPTION_UINT(0, "render-threads", &conf->render_threads, 0),
 		CONF_OPTION_STRING(0, "rotate", &conf->rotate, "normal"),
 
 		/* Font Options */
@@ -754,6 +770,7 @@ int kmscon_conf_new(struct conf_ctx **out)
 		CONF_OPTION_UINT(0, "font-size", &conf->font_size, 12),
 		CONF_OPTION_STRING(0, "font-name", &conf->font_name, "monospace"),
 		CONF_OPTION_UINT(0, "font-dpi", &conf->font_ppi, 96),
+		CONF_OPTION_UINT(0, "glyph-cache", &conf->glyph_cache, 8),
 
 		/* Palette Options */
 		CONF_OPTION_STRING(0, "palette", &conf->palette, NULL),
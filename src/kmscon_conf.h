@@ -149,6 +149,14 @@ struct kmscon_conf_t {
 	unsigned int gpus;
 	/* render engine */
 	char *render_engine;
+	/* render into shadow buffers in system memory */
+	bool shadow_buffer;
+	/* video memory for glyph atlases in MiB; 0 is unlimited */
+	unsigned int atlas_budget;
+	/* system memory for blended glyphs in MiB; 0 disables the cache */
+	unsigned int tile_cache;
+	/* render threads of software backends; 0 is one per CPU */
+	unsigned int render_threads;
 	/* orientation/rotation of output */
 	char *rotate;
 
@@ -161,6 +169,8 @@ struct kmscon_conf_t {
 	char *font_name;
 	/* font ppi (overrides per monitor PPI) */
 	unsigned int font_ppi;
+	/* memory for rendered glyphs in MiB; 0 is unlimited */
+	unsigned int glyph_cache;
 
 	/* Palette Options */
 	/* color palette */
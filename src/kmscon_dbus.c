@@ -0,0 +1,440 @@
+/*
+ * D-Bus Integration
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * D-Bus Integration
+ * libdbus does not run its own main-loop. Instead, it reports every fd it
+ * wants to watch and every timeout it needs via callbacks. We map these onto
+ * sources of our event loop. libdbus may register separate read and write
+ * watches for the same socket, so each watch gets its own dup()ed fd as epoll
+ * refuses to add one fd twice.
+ * Messages are never dispatched from inside libdbus callbacks. Whenever the
+ * dispatch-status says there is data left, we schedule an idle callback that
+ * drains the incoming queue.
+ */
+
+#include <dbus/dbus.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "eloop.h"
+#include "kmscon_dbus.h"
+#include "shl_log.h"
+
+#define LOG_SUBSYSTEM "dbus"
+
+struct kmscon_dbus {
+	unsigned long ref;
+	struct ev_eloop *eloop;
+	DBusConnection *conn;
+
+	/* users of the accelerometer of iio-sensor-proxy */
+	unsigned long accel_claims;
+};
+
+struct dbus_watch_src {
+	struct kmscon_dbus *dbus;
+	DBusWatch *watch;
+	struct ev_fd *efd;
+	int fd;
+};
+
+struct dbus_timeout_src {
+	struct kmscon_dbus *dbus;
+	DBusTimeout *timeout;
+	struct ev_timer *timer;
+};
+
+static void dbus_dispatch_idle(struct ev_eloop *eloop, void *unused,
+			       void *data)
+{
+	struct kmscon_dbus *dbus = data;
+
+	while (dbus_connection_dispatch(dbus->conn) ==
+						DBUS_DISPATCH_DATA_REMAINS)
+		/* empty */ ;
+}
+
+static void dbus_schedule_dispatch(struct kmscon_dbus *dbus)
+{
+	int ret;
+
+	if (dbus_connection_get_dispatch_status(dbus->conn) !=
+						DBUS_DISPATCH_DATA_REMAINS)
+		return;
+
+	ret = ev_eloop_register_idle_cb(dbus->eloop, dbus_dispatch_idle, dbus,
+					EV_ONESHOT | EV_SINGLE);
+	if (ret)
+		log_warning("cannot schedule D-Bus dispatching: %d", ret);
+}
+
+static void dbus_dispatch_status(DBusConnection *conn,
+				 DBusDispatchStatus status, void *data)
+{
+	struct kmscon_dbus *dbus = data;
+
+	if (status == DBUS_DISPATCH_DATA_REMAINS)
+		dbus_schedule_dispatch(dbus);
+}
+
+static int watch_mask(DBusWatch *watch)
+{
+	unsigned int flags;
+	int mask = 0;
+
+	flags = dbus_watch_get_flags(watch);
+	if (flags & DBUS_WATCH_READABLE)
+		mask |= EV_READABLE;
+	if (flags & DBUS_WATCH_WRITABLE)
+		mask |= EV_WRITEABLE;
+
+	return mask;
+}
+
+static void watch_event(struct ev_fd *fd, int mask, void *data)
+{
+	struct dbus_watch_src *src = data;
+	struct kmscon_dbus *dbus = src->dbus;
+	unsigned int flags = 0;
+
+	if (mask & EV_READABLE)
+		flags |= DBUS_WATCH_READABLE;
+	if (mask & EV_WRITEABLE)
+		flags |= DBUS_WATCH_WRITABLE;
+	if (mask & EV_HUP)
+		flags |= DBUS_WATCH_HANGUP;
+	if (mask & EV_ERR)
+		flags |= DBUS_WATCH_ERROR;
+
+	/* this may remove the watch, so do not touch @src afterwards */
+	dbus_watch_handle(src->watch, flags);
+	dbus_schedule_dispatch(dbus);
+}
+
+static dbus_bool_t watch_add(DBusWatch *watch, void *data)
+{
+	struct kmscon_dbus *dbus = data;
+	struct dbus_watch_src *src;
+	int ret;
+
+	src = malloc(sizeof(*src));
+	if (!src)
+		return FALSE;
+	memset(src, 0, sizeof(*src));
+	src->dbus = dbus;
+	src->watch = watch;
+
+	src->fd = fcntl(dbus_watch_get_unix_fd(watch), F_DUPFD_CLOEXEC, 0);
+	if (src->fd < 0) {
+		log_error("cannot duplicate D-Bus fd (%d): %m", errno);
+		goto err_free;
+	}
+
+	ret = ev_eloop_new_fd(dbus->eloop, &src->efd, src->fd,
+			      watch_mask(watch), watch_event, src);
+	if (ret) {
+		log_error("cannot add D-Bus watch to event loop: %d", ret);
+		goto err_fd;
+	}
+
+	if (!dbus_watch_get_enabled(watch))
+		ev_fd_disable(src->efd);
+
+	dbus_watch_set_data(watch, src, NULL);
+	return TRUE;
+
+err_fd:
+	close(src->fd);
+err_free:
+	free(src);
+	return FALSE;
+}
+
+static void watch_remove(DBusWatch *watch, void *data)
+{
+	struct dbus_watch_src *src;
+
+	src = dbus_watch_get_data(watch);
+	if (!src)
+		return;
+
+	dbus_watch_set_data(watch, NULL, NULL);
+	ev_eloop_rm_fd(src->efd);
+	close(src->fd);
+	free(src);
+}
+
+static void watch_toggled(DBusWatch *watch, void *data)
+{
+	struct dbus_watch_src *src;
+
+	src = dbus_watch_get_data(watch);
+	if (!src)
+		return;
+
+	if (dbus_watch_get_enabled(watch)) {
+		ev_fd_update(src->efd, watch_mask(watch));
+		ev_fd_enable(src->efd);
+	} else {
+		ev_fd_disable(src->efd);
+	}
+}
+
+static void timeout_spec(DBusTimeout *timeout, struct itimerspec *spec)
+{
+	int msecs;
+
+	msecs = dbus_timeout_get_interval(timeout);
+	if (msecs <= 0)
+		msecs = 1;
+
+	memset(spec, 0, sizeof(*spec));
+	spec->it_value.tv_sec = msecs / 1000;
+	spec->it_value.tv_nsec = (msecs % 1000) * 1000 * 1000;
+	spec->it_interval = spec->it_value;
+}
+
+static void timeout_event(struct ev_timer *timer, uint64_t num, void *data)
+{
+	struct dbus_timeout_src *src = data;
+	struct kmscon_dbus *dbus = src->dbus;
+
+	/* this may remove the timeout, so do not touch @src afterwards */
+	dbus_timeout_handle(src->timeout);
+	dbus_schedule_dispatch(dbus);
+}
+
+static dbus_bool_t timeout_add(DBusTimeout *timeout, void *data)
+{
+	struct kmscon_dbus *dbus = data;
+	struct dbus_timeout_src *src;
+	struct itimerspec spec;
+	int ret;
+
+	src = malloc(sizeof(*src));
+	if (!src)
+		return FALSE;
+	memset(src, 0, sizeof(*src));
+	src->dbus = dbus;
+	src->timeout = timeout;
+
+	timeout_spec(timeout, &spec);
+	ret = ev_eloop_new_timer(dbus->eloop, &src->timer, &spec,
+				 timeout_event, src);
+	if (ret) {
+		log_error("cannot add D-Bus timeout to event loop: %d", ret);
+		free(src);
+		return FALSE;
+	}
+
+	if (!dbus_timeout_get_enabled(timeout))
+		ev_timer_disable(src->timer);
+
+	dbus_timeout_set_data(timeout, src, NULL);
+	return TRUE;
+}
+
+static void timeout_remove(DBusTimeout *timeout, void *data)
+{
+	struct dbus_timeout_src *src;
+
+	src = dbus_timeout_get_data(timeout);
+	if (!src)
+		return;
+
+	dbus_timeout_set_data(timeout, NULL, NULL);
+	ev_eloop_rm_timer(src->timer);
+	free(src);
+}
+
+static void timeout_toggled(DBusTimeout *timeout, void *data)
+{
+	struct dbus_timeout_src *src;
+	struct itimerspec spec;
+
+	src = dbus_timeout_get_data(timeout);
+	if (!src)
+		return;
+
+	/* libdbus expects the interval to restart when re-enabled */
+	if (dbus_timeout_get_enabled(timeout)) {
+		timeout_spec(timeout, &spec);
+		ev_timer_update(src->timer, &spec);
+		ev_timer_enable(src->timer);
+	} else {
+		ev_timer_disable(src->timer);
+	}
+}
+
+int kmscon_dbus_new(struct kmscon_dbus **out, struct ev_eloop *eloop,
+		    DBusBusType type)
+{
+	struct kmscon_dbus *dbus;
+	DBusError err;
+	int ret;
+
+	if (!out || !eloop)
+		return -EINVAL;
+
+	dbus = malloc(sizeof(*dbus));
+	if (!dbus)
+		return -ENOMEM;
+	memset(dbus, 0, sizeof(*dbus));
+	dbus->ref = 1;
+	dbus->eloop = eloop;
+
+	/* a private connection so nobody else can install a main-loop on it */
+	dbus_error_init(&err);
+	dbus->conn = dbus_bus_get_private(type, &err);
+	if (!dbus->conn) {
+		log_warning("cannot connect to D-Bus: %s",
+			    err.message ? err.message : "unknown error");
+		dbus_error_free(&err);
+		ret = -ENOTCONN;
+		goto err_free;
+	}
+
+	dbus_connection_set_exit_on_disconnect(dbus->conn, FALSE);
+
+	if (!dbus_connection_set_watch_functions(dbus->conn, watch_add,
+						 watch_remove, watch_toggled,
+						 dbus, NULL)) {
+		log_error("cannot set D-Bus watch functions");
+		ret = -ENOMEM;
+		goto err_conn;
+	}
+
+	if (!dbus_connection_set_timeout_functions(dbus->conn, timeout_add,
+						   timeout_remove,
+						   timeout_toggled,
+						   dbus, NULL)) {
+		log_error("cannot set D-Bus timeout functions");
+		ret = -ENOMEM;
+		goto err_watch;
+	}
+
+	dbus_connection_set_dispatch_status_function(dbus->conn,
+						     dbus_dispatch_status,
+						     dbus, NULL);
+
+	/* the bus may have queued messages (like NameAcquired) already */
+	dbus_schedule_dispatch(dbus);
+
+	ev_eloop_ref(dbus->eloop);
+	*out = dbus;
+	return 0;
+
+err_watch:
+	dbus_connection_set_watch_functions(dbus->conn, NULL, NULL, NULL,
+					    NULL, NULL);
+err_conn:
+	dbus_connection_close(dbus->conn);
+	dbus_connection_unref(dbus->conn);
+err_free:
+	free(dbus);
+	return ret;
+}
+
+void kmscon_dbus_ref(struct kmscon_dbus *dbus)
+{
+	if (!dbus || !dbus->ref)
+		return;
+
+	++dbus->ref;
+}
+
+void kmscon_dbus_unref(struct kmscon_dbus *dbus)
+{
+	if (!dbus || !dbus->ref || --dbus->ref)
+		return;
+
+	ev_eloop_unregister_idle_cb(dbus->eloop, dbus_dispatch_idle, dbus,
+				    EV_SINGLE);
+	dbus_connection_set_dispatch_status_function(dbus->conn, NULL, NULL,
+						     NULL);
+	/* push out pending messages like the release of claimed devices */
+	dbus_connection_flush(dbus->conn);
+	dbus_connection_close(dbus->conn);
+	dbus_connection_set_timeout_functions(dbus->conn, NULL, NULL, NULL,
+					      NULL, NULL);
+	dbus_connection_set_watch_functions(dbus->conn, NULL, NULL, NULL,
+					    NULL, NULL);
+	dbus_connection_unref(dbus->conn);
+	ev_eloop_unref(dbus->eloop);
+	free(dbus);
+}
+
+DBusConnection *kmscon_dbus_get_connection(struct kmscon_dbus *dbus)
+{
+	if (!dbus)
+		return NULL;
+
+	return dbus->conn;
+}
+
+static void sensor_call(struct kmscon_dbus *dbus, const char *method)
+{
+	DBusMessage *msg;
+
+	msg = dbus_message_new_method_call("net.hadess.SensorProxy",
+					   "/net/hadess/SensorProxy",
+					   "net.hadess.SensorProxy", method);
+	if (!msg) {
+		log_warning("cannot create D-Bus message %s", method);
+		return;
+	}
+
+	if (!dbus_connection_send(dbus->conn, msg, NULL))
+		log_warning("cannot send D-Bus message %s", method);
+
+	dbus_message_unref(msg);
+}
+
+/*
+ * iio-sensor-proxy tracks accelerometer claims per bus connection, and all
+ * sessions of a seat share its connection. So the claim is counted here and
+ * only the first claim and the last release are sent to the proxy.
+ */
+void kmscon_dbus_claim_accelerometer(struct kmscon_dbus *dbus)
+{
+	if (!dbus)
+		return;
+
+	if (!dbus->accel_claims++)
+		sensor_call(dbus, "ClaimAccelerometer");
+}
+
+void kmscon_dbus_release_accelerometer(struct kmscon_dbus *dbus)
+{
+	if (!dbus || !dbus->accel_claims)
+		return;
+
+	if (!--dbus->accel_claims)
+		sensor_call(dbus, "ReleaseAccelerometer");
+}
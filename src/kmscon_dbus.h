@@ -0,0 +1,55 @@
+/*
+ * D-Bus Integration
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * D-Bus Integration
+ * Each seat owns a single private bus connection which is shared by all its
+ * sessions. The libdbus watches and timeouts are mapped onto ev_fd and
+ * ev_timer sources of the seat's event loop and incoming messages are
+ * dispatched from an idle callback. Hence, nothing ever polls the bus and
+ * nothing blocks on it, as long as users only send messages asynchronously
+ * (dbus_connection_send_with_reply() or dbus_connection_send()).
+ */
+
+#ifndef KMSCON_DBUS_H
+#define KMSCON_DBUS_H
+
+#include <dbus/dbus.h>
+#include <stdlib.h>
+#include "eloop.h"
+
+struct kmscon_dbus;
+
+int kmscon_dbus_new(struct kmscon_dbus **out, struct ev_eloop *eloop,
+		    DBusBusType type);
+void kmscon_dbus_ref(struct kmscon_dbus *dbus);
+void kmscon_dbus_unref(struct kmscon_dbus *dbus);
+
+DBusConnection *kmscon_dbus_get_connection(struct kmscon_dbus *dbus);
+
+void kmscon_dbus_claim_accelerometer(struct kmscon_dbus *dbus);
+void kmscon_dbus_release_accelerometer(struct kmscon_dbus *dbus);
+
+#endif /* KMSCON_DBUS_H */
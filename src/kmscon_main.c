@@ -381,6 +381,10 @@ static int app_seat_add_video(struct app_seat *seat,
 		}
 	}
 
+	uterm_video_set_shadow(vid->video, seat->conf->shadow_buffer);
+	uterm_video_set_render_threads(vid->video,
+				       seat->conf->render_threads);
+
 	ret = uterm_video_register_cb(vid->video, app_seat_video_event, vid);
 	if (ret) {
 		log_error("cannot register video callback for device %s on seat %s: %d",
@@ -25,7 +25,7 @@
 
 /*
  * OpenGL Texture based rendering backend module
- * This module provides the gltex renderer backend.
+ * This module provides the gltex renderer backends.
  */
 
 #include <errno.h>
@@ -47,11 +47,20 @@ static int kmscon_gltex_load(void)
 		return ret;
 	}
 
+	kmscon_text_gltex_grid_ops.owner = KMSCON_THIS_MODULE;
+	ret = kmscon_text_register(&kmscon_text_gltex_grid_ops);
+	if (ret) {
+		log_error("cannot register gltex-grid renderer");
+		kmscon_text_unregister(kmscon_text_gltex_ops.name);
+		return ret;
+	}
+
 	return 0;
 }
 
 static void kmscon_gltex_unload(void)
 {
+	kmscon_text_unregister(kmscon_text_gltex_grid_ops.name);
 	kmscon_text_unregister(kmscon_text_gltex_ops.name);
 }
 
@@ -1,8 +1,9 @@
+#include <errno.h>
 #include <fcntl.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/select.h>
+#include <string.h>
 #include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
@@ -13,14 +14,14 @@
 #include "text.h"
 
 // utility functions for internal (kmscon_mouse) use only
-int mouse_ready_to_read(int handle);
 void mouse_hide_timer_cb(struct ev_timer *timer, uint64_t num, void *data);
 void handle_clicks (struct kmscon_mouse_info* mouse, int button);
 void update_mouse_button_state (struct kmscon_mouse_info* mouse,
                                 int button,
                                 char button_mask,
                                 char buffer);
-void mouse_query_timer_cb(struct ev_timer *timer, uint64_t num, void *data);
+int mouse_handle_packet(struct kmscon_mouse_info* mouse, const char* buffer);
+void mouse_event_cb(struct ev_fd *fd, int mask, void *data);
 
 // public API
 struct kmscon_mouse_info* kmscon_mouse_init(struct ev_eloop* eloop,
@@ -33,6 +34,7 @@ struct kmscon_mouse_info* kmscon_mouse_init(struct ev_eloop* eloop,
 		goto err;
 
 	mouse->seat = seat;
+	mouse->device = -1;
 	mouse->state[KMSCON_MOUSE_BUTTON_LEFT] = KMSCON_MOUSE_BUTTON_RELEASED;
 	mouse->state[KMSCON_MOUSE_BUTTON_MIDDLE] = KMSCON_MOUSE_BUTTON_RELEASED;
 	mouse->state[KMSCON_MOUSE_BUTTON_RIGHT] = KMSCON_MOUSE_BUTTON_RELEASED;
@@ -62,32 +64,21 @@ struct kmscon_mouse_info* kmscon_mouse_init(struct ev_eloop* eloop,
 	if (use_mouse) {
 		mouse->hide = true;
 
-		// mouse-query timer
-		mouse->query_timer_spec.it_interval.tv_sec  = 0;
-		mouse->query_timer_spec.it_interval.tv_nsec = 10*1000*1000;
-		mouse->query_timer_spec.it_value.tv_sec  = 0;
-		mouse->query_timer_spec.it_value.tv_nsec = 10*1000*1000;
-
-		int ret = ev_timer_new(&mouse->query_timer,
-							   &mouse->query_timer_spec,
-							   mouse_query_timer_cb,
-							   mouse,
-							   NULL,
-							   NULL);
+		// the device is only read when the kernel has packets for us,
+		// an idle pointer causes no wakeups at all
+		int ret = ev_eloop_new_fd(eloop,
+								  &mouse->efd,
+								  mouse->device,
+								  EV_READABLE,
+								  mouse_event_cb,
+								  mouse);
 		if (ret) {
-			log_error("cannot create mouse-query timer: %d", ret);
+			log_error("cannot add mouse-device to event-loop: %d", ret);
 			goto err;
 		}
-		ev_timer_enable(mouse->query_timer);
 
-		ret = ev_eloop_add_timer(eloop, mouse->query_timer);
-		if (ret) {
-			log_error("cannot add mouse-query timer to event-loop: %d", ret);
-			goto err;
-		}
-
-		// mouse-hide timer
-		mouse->hide_timer_spec.it_interval.tv_sec  = 5;
+		// mouse-hide timer, one-shot and re-armed on every movement
+		mouse->hide_timer_spec.it_interval.tv_sec  = 0;
 		mouse->hide_timer_spec.it_interval.tv_nsec = 0;
 		mouse->hide_timer_spec.it_value.tv_sec  = 5;
 		mouse->hide_timer_spec.it_value.tv_nsec = 0;
@@ -121,6 +112,12 @@ err:
 void kmscon_mouse_cleanup(struct kmscon_mouse_info* mouse)
 {
 	if (mouse) {
+		ev_eloop_rm_fd(mouse->efd);
+		ev_eloop_rm_timer(mouse->hide_timer);
+		ev_timer_unref(mouse->hide_timer);
+		if (mouse->device >= 0) {
+			close(mouse->device);
+		}
 		if (mouse->selection) {
 			free(mouse->selection);
 		}
@@ -306,29 +303,6 @@ int kmscon_mouse_is_selection_empty(struct kmscon_mouse_info* mouse)
 }
 
 // internal API/utility functions
-int mouse_ready_to_read(int handle)
-{
-	const struct timespec timeout = {0, 3*1000*1000};
-	fd_set readfds;
-
-	FD_ZERO(&readfds);
-	FD_SET(handle, &readfds);
-	int result = pselect(handle + 1, &readfds, NULL, NULL, &timeout, NULL);
-	if (result == -1) {
-		log_error("There was an error trying to check for available mouse-data.");
-		return 0;
-	} else if (result == 0) {
-		return 0;
-	} else {
-		result = FD_ISSET(handle, &readfds);
-		if (result) {
-			return 1;
-		}
-	}
-
-	return 0;
-}
-
 void mouse_hide_timer_cb(struct ev_timer *timer,
 						 uint64_t num,
 						 void *data)
@@ -340,7 +314,10 @@ void mouse_hide_timer_cb(struct ev_timer *timer,
 
 	struct kmscon_mouse_info* mouse = NULL;
 	mouse = (struct kmscon_mouse_info*) data;
-	mouse->hide = true;
+	if (!mouse->hide) {
+		mouse->hide = true;
+		kmscon_seat_refresh_display(mouse->seat, mouse->disp);
+	}
 }
 
 void handle_clicks (struct kmscon_mouse_info* mouse, int button)
@@ -423,56 +400,98 @@ void update_mouse_button_state(struct kmscon_mouse_info* mouse,
 	mouse->state[button] = new_state;
 }
 
-void mouse_query_timer_cb(struct ev_timer *timer, uint64_t num, void *data)
+// returns true if the packet changed anything visible
+int mouse_handle_packet(struct kmscon_mouse_info* mouse, const char* buffer)
+{
+	float old_x = mouse->x;
+	float old_y = mouse->y;
+	kmscon_mouse_button_state old_state[3];
+	short relative_x = (short) buffer[1];
+	short relative_y = (short) buffer[2];
+
+	memcpy(old_state, mouse->state, sizeof(old_state));
+
+	mouse->x += .0025 * (float) relative_x/MOTION_SCALE;
+	mouse->y += .0025 * (float) relative_y/MOTION_SCALE;
+
+	// limit 'normalized' coordinates to the extents of the GL-viewport
+	if (mouse->x < -1.f) mouse->x = -1.f;
+	if (mouse->x > 1.f) mouse->x = 1.f;
+	if (mouse->y < -1.f) mouse->y = -1.f;
+	if (mouse->y > 1.f) mouse->y = 1.f;
+
+	update_mouse_button_state (mouse,
+							   KMSCON_MOUSE_BUTTON_LEFT,
+							   BUTTON_MASK_LEFT,
+							   buffer[0]);
+	update_mouse_button_state (mouse,
+							   KMSCON_MOUSE_BUTTON_MIDDLE,
+							   BUTTON_MASK_MIDDLE,
+							   buffer[0]);
+	update_mouse_button_state (mouse,
+							   KMSCON_MOUSE_BUTTON_RIGHT,
+							   BUTTON_MASK_RIGHT,
+							   buffer[0]);
+
+	return mouse->x != old_x || mouse->y != old_y ||
+		   memcmp(old_state, mouse->state, sizeof(old_state));
+}
+
+void mouse_event_cb(struct ev_fd *fd, int mask, void *data)
 {
 	if (!data) {
-		log_warn("No valid pointer passed to mouse_query_timer_cb().");
+		log_warn("No valid pointer passed to mouse_event_cb().");
 		return;
 	}
 
 	struct kmscon_mouse_info* mouse = (struct kmscon_mouse_info*) data;
 	ssize_t size = 0;
-	short relative_x = 0;
-	short relative_y = 0;
 	char buffer[BUFFER_SIZE];
+	int changed = false;
+	int packets = 0;
+
+	if (mask & (EV_HUP | EV_ERR)) {
+		log_warn("mouse-device hung up, disabling mouse");
+		ev_eloop_rm_fd(mouse->efd);
+		mouse->efd = NULL;
+		mouse->hide = true;
+		kmscon_seat_refresh_display(mouse->seat, mouse->disp);
+		return;
+	}
 
-	if (mouse_ready_to_read (mouse->device)) {
+	// drain everything queued since the last wakeup so a fast pointer
+	// results in a single refresh instead of one per packet
+	while (true) {
 		size = read(mouse->device, buffer, sizeof (buffer));
-		if (size != BUFFER_SIZE) {
+		if (size < 0) {
+			if (errno != EAGAIN && errno != EINTR)
+				log_error("Error reading device event: %m");
+			break;
+		} else if (size != BUFFER_SIZE) {
 			log_error("Error reading device event... buffer-size mismatch!");
-			return;
+			break;
 		}
-		relative_x = (short) buffer[1];
-		relative_y = (short) buffer[2];
-		mouse->x += .0025 * (float) relative_x/MOTION_SCALE;
-		mouse->y += .0025 * (float) relative_y/MOTION_SCALE;
-
-		// limit 'normalized' coordinates to the extents of the GL-viewport
-		if (mouse->x < -1.f) mouse->x = -1.f;
-		if (mouse->x > 1.f) mouse->x = 1.f;
-		if (mouse->y < -1.f) mouse->y = -1.f;
-		if (mouse->y > 1.f) mouse->y = 1.f;
-
-		update_mouse_button_state (mouse,
-								   KMSCON_MOUSE_BUTTON_LEFT,
-								   BUTTON_MASK_LEFT,
-								   buffer[0]);
-		update_mouse_button_state (mouse,
-								   KMSCON_MOUSE_BUTTON_MIDDLE,
-								   BUTTON_MASK_MIDDLE,
-								   buffer[0]);
-		update_mouse_button_state (mouse,
-								   KMSCON_MOUSE_BUTTON_RIGHT,
-								   BUTTON_MASK_RIGHT,
-								   buffer[0]);
 
+		++packets;
+		if (mouse_handle_packet(mouse, buffer))
+			changed = true;
+	}
+
+	if (!packets)
+		return;
+
+	ev_timer_update(mouse->hide_timer, &mouse->hide_timer_spec);
+
+	if (mouse->hide) {
 		mouse->hide = false;
+		changed = true;
+	}
 
-		// FIXME: Triggering the refresh like this works, but
-		// it's not an elegant solution. Using an event would
-		// be nicer, but I did not yet fully grasp the pile of
-		// event-loops kmscon uses. There has to be a way to
-		// trigger a refresh via the event-loops of uterm_video.
+	// FIXME: Triggering the refresh like this works, but
+	// it's not an elegant solution. Using an event would
+	// be nicer, but I did not yet fully grasp the pile of
+	// event-loops kmscon uses. There has to be a way to
+	// trigger a refresh via the event-loops of uterm_video.
+	if (changed)
 		kmscon_seat_refresh_display(mouse->seat, mouse->disp);
-	}
 }
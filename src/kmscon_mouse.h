@@ -84,8 +84,7 @@ struct kmscon_selection_info {
 struct kmscon_mouse_info {
 	struct kmscon_selection_info* selection;
 
-	struct ev_timer* query_timer;
-	struct itimerspec query_timer_spec;
+	struct ev_fd* efd;
 
 	struct ev_timer* hide_timer;
 	struct itimerspec hide_timer_spec;
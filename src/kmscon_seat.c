@@ -36,6 +36,7 @@
 #include "conf.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
+#include "kmscon_dbus.h"
 #include "kmscon_dummy.h"
 #include "kmscon_mouse.h"
 #include "kmscon_seat.h"
@@ -99,6 +100,7 @@ struct kmscon_seat {
 	unsigned int async_schedule;
 
 	struct kmscon_mouse_info* mouse;
+	struct kmscon_dbus *dbus;
 
 	kmscon_seat_cb_t cb;
 	void *data;
@@ -779,6 +781,11 @@ int kmscon_seat_new(struct kmscon_seat **out,
 	if (ret)
 		goto err_input_cb;
 
+	/* D-Bus is optional; sessions check for a NULL connection */
+	ret = kmscon_dbus_new(&seat->dbus, seat->eloop, DBUS_BUS_SYSTEM);
+	if (ret)
+		log_warning("seat %s runs without D-Bus: %d", seat->name, ret);
+
 	ev_eloop_ref(seat->eloop);
 	uterm_vt_master_ref(seat->vtm);
 	*out = seat;
@@ -831,12 +838,12 @@ void kmscon_seat_free(struct kmscon_seat *seat)
 		seat_remove_display(seat, d);
 	}
 
+	kmscon_dbus_unref(seat->dbus);
 	uterm_vt_deallocate(seat->vt);
 	uterm_input_unregister_cb(seat->input, seat_input_event, seat);
 	uterm_input_unref(seat->input);
 	kmscon_conf_free(seat->conf_ctx);
-	free(seat->mouse->selection);
-	free(seat->mouse);
+	kmscon_mouse_cleanup(seat->mouse);
 	free(seat->name);
 	uterm_vt_master_unref(seat->vtm);
 	ev_eloop_unref(seat->eloop);
@@ -981,6 +988,14 @@ struct kmscon_mouse_info *kmscon_seat_get_mouse(struct kmscon_seat *seat)
    return seat->mouse;
 }
 
+struct kmscon_dbus *kmscon_seat_get_dbus(struct kmscon_seat *seat)
+{
+	if (!seat)
+		return NULL;
+
+	return seat->dbus;
+}
+
 void kmscon_seat_schedule(struct kmscon_seat *seat, unsigned int id)
 {
 	struct shl_dlist *iter;
@@ -35,6 +35,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include "kmscon_dbus.h"
 #include "kmscon_mouse.h"
 #include "conf.h"
 #include "eloop.h"
@@ -101,6 +102,7 @@ struct ev_eloop *kmscon_seat_get_eloop(struct kmscon_seat *seat);
 struct conf_ctx *kmscon_seat_get_conf(struct kmscon_seat *seat);
 
 struct kmscon_mouse_info *kmscon_seat_get_mouse(struct kmscon_seat *seat);
+struct kmscon_dbus *kmscon_seat_get_dbus(struct kmscon_seat *seat);
 struct shl_dlist kmscon_seat_get_displays(struct kmscon_seat *seat);
 
 void kmscon_seat_schedule(struct kmscon_seat *seat, unsigned int id);
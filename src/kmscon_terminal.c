@@ -47,6 +47,7 @@
 #include "conf.h"
 #include "eloop.h"
 #include "kmscon_conf.h"
+#include "kmscon_dbus.h"
 #include "kmscon_mouse.h"
 #include "kmscon_seat.h"
 #include "kmscon_terminal.h"
@@ -59,15 +60,16 @@
 
 #define LOG_SUBSYSTEM "terminal"
 
-#include <dbus/dbus.h>
 static const char* FDO_PROPS_INTERFACE = "org.freedesktop.DBus.Properties";
 static const char* FDO_GET_METHOD = "Get";
-static const char* GYRO_CLAIM_METHOD = "ClaimAccelerometer";
-static const char* GYRO_RELEASE_METHOD = "ReleaseAccelerometer";
 static const char* SENSOR_INTERFACE = "net.hadess.SensorProxy";
 static const char* DESTINATION = "net.hadess.SensorProxy";
 static const char* SENSOR_PATH = "/net/hadess/SensorProxy";
 static const char* PROPERTY_HAS_GYRO = "HasAccelerometer";
+static const char* GYRO_MATCH = "type='signal',"
+				 "interface='org.freedesktop.DBus.Properties',"
+				 "member='PropertiesChanged',"
+				 "sender='net.hadess.SensorProxy'";
 
 struct screen {
 	struct shl_dlist list;
@@ -77,6 +79,9 @@ struct screen {
 
 	bool swapping;
 	bool pending;
+
+	/* tsm_screen_draw() age of the content of each back-buffer */
+	tsm_age_t age[2];
 };
 
 struct kmscon_terminal {
@@ -98,18 +103,20 @@ struct kmscon_terminal {
 	struct tsm_vte *vte;
 	struct kmscon_pty *pty;
 	struct ev_fd *ptyfd;
+	/* keyboard input was written to the pty, its echo is drawn at once */
+	bool echo;
+	unsigned long pty_writes;
 
 	struct kmscon_font_attr font_attr;
 	struct kmscon_font *font;
 	struct kmscon_font *bold_font;
+	struct ev_counter *glyph_cnt;
 
 	struct kmscon_mouse_info* mouse;
 	struct kmscon_selection_info* selection;
 
-	DBusError dbus_error;
-	DBusConnection* dbus_connection;
-	struct ev_timer* dbus_gyro_query_timer;
-	struct itimerspec dbus_gyro_query_timer_spec;
+	struct kmscon_dbus* dbus;
+	DBusPendingCall* gyro_pending;
 	bool has_gyro;
 };
 
@@ -156,6 +163,27 @@ static void do_clear_margins(struct screen *scr)
 	}
 }
 
+/*
+ * Forget what is stored in the back-buffers of a screen so the next redraws
+ * paint everything again. This is needed whenever the buffer content changes
+ * behind libtsm's back, like on font changes, rotation or VT switches.
+ */
+static void damage_screen(struct screen *scr)
+{
+	memset(scr->age, 0, sizeof(scr->age));
+}
+
+static void damage_all(struct kmscon_terminal *term)
+{
+	struct shl_dlist *iter;
+	struct screen *scr;
+
+	shl_dlist_for_each(iter, &term->screens) {
+		scr = shl_dlist_entry(iter, struct screen, list);
+		damage_screen(scr);
+	}
+}
+
 static void handle_mouse_word_selection(struct kmscon_mouse_info* mouse,
 										struct kmscon_text* text,
 										struct tsm_screen* console)
@@ -272,12 +300,13 @@ DBusHandlerResult properties_changed_cb(DBusConnection* connection,
 	DBusError error;
 	dbus_error_init (&error);
 
-	const char* interface = dbus_message_get_interface (message);
 	const char* path = dbus_message_get_path (message);
 
-	if (!interface || !path ||
-		(strncmp (interface, FDO_PROPS_INTERFACE, 31) != 0 &&
-		 strncmp (path, SENSOR_PATH, 23) != 0)) {
+	// the connection is shared by the whole seat, so only look at the
+	// sensor-proxy signals and let every terminal see them
+	if (!path || strcmp (path, SENSOR_PATH) != 0 ||
+		!dbus_message_is_signal (message, FDO_PROPS_INTERFACE,
+								 "PropertiesChanged")) {
 			dbus_error_free (&error);
 			return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
 	}
@@ -339,6 +368,7 @@ DBusHandlerResult properties_changed_cb(DBusConnection* connection,
 		if (strncmp(orientation, "bottom-up", 9) == 0)
 			kmscon_text_rotate(scr->txt, ORIENTATION_INVERTED);
 
+		damage_screen(scr);
 		term->min_cols = 0;
 		term->min_rows = 0;
 		terminal_resize(term,
@@ -352,102 +382,161 @@ DBusHandlerResult properties_changed_cb(DBusConnection* connection,
 
 	dbus_error_free (&error);
 
-	return DBUS_HANDLER_RESULT_HANDLED;
+	return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
 }
 
-DBusMessage* get_property (DBusConnection* connection,
-						   DBusError* error,
-						   const char* property)
+static void gyro_enable(struct kmscon_terminal* term)
 {
-	DBusMessage* message = dbus_message_new_method_call (DESTINATION,
-														 SENSOR_PATH,
-														 FDO_PROPS_INTERFACE,
-														 FDO_GET_METHOD);
-	if (!message) {
-		return NULL;
+	DBusConnection* connection = kmscon_dbus_get_connection(term->dbus);
+
+	// a NULL error makes the match asynchronous
+	dbus_bus_add_match (connection, GYRO_MATCH, NULL);
+
+	dbus_bool_t result = dbus_connection_add_filter(connection,
+													properties_changed_cb,
+													term,
+													NULL);
+	if (!result) {
+		log_info("Failed to add filter to connection");
+		return;
 	}
 
-	const char* interface = SENSOR_INTERFACE;
-	DBusMessageIter args;
-	dbus_message_iter_init_append (message, &args);
-	dbus_message_iter_append_basic (&args, DBUS_TYPE_STRING, &interface);
-	dbus_message_iter_append_basic (&args, DBUS_TYPE_STRING, &property);
+	term->has_gyro = true;
+	kmscon_dbus_claim_accelerometer(term->dbus);
+}
 
-	DBusMessage* reply = dbus_connection_send_with_reply_and_block (connection,
-																	message,
-																	-1,
-																	error);
-	dbus_message_unref (message);
+static void gyro_disable(struct kmscon_terminal* term)
+{
+	DBusConnection* connection = kmscon_dbus_get_connection(term->dbus);
 
-	return reply;
+	if (term->gyro_pending) {
+		dbus_pending_call_cancel (term->gyro_pending);
+		dbus_pending_call_unref (term->gyro_pending);
+		term->gyro_pending = NULL;
+	}
+
+	if (!term->has_gyro) {
+		return;
+	}
+
+	kmscon_dbus_release_accelerometer(term->dbus);
+	dbus_connection_remove_filter (connection, properties_changed_cb, term);
+	dbus_bus_remove_match (connection, GYRO_MATCH, NULL);
+	term->has_gyro = false;
 }
 
-dbus_bool_t has_gyro (DBusConnection* connection, DBusError* error)
+static void has_gyro_reply (DBusPendingCall* pending, void* data)
 {
-	DBusMessage* reply = get_property (connection, error, PROPERTY_HAS_GYRO);
+	struct kmscon_terminal* term = (struct kmscon_terminal*) data;
+	DBusMessage* reply = dbus_pending_call_steal_reply (pending);
+	dbus_bool_t accelerometer = false;
+
+	dbus_pending_call_unref (term->gyro_pending);
+	term->gyro_pending = NULL;
 
 	if (!reply) {
 		log_error("dbus-message is NULL!");
-		return 0;
+		return;
 	}
 
 	if (dbus_message_get_type (reply) == DBUS_MESSAGE_TYPE_ERROR) {
-		log_error("%s", dbus_message_get_error_name (reply));
-		return 0;
+		log_info("no sensor-proxy: %s", dbus_message_get_error_name (reply));
+		dbus_message_unref (reply);
+		return;
 	}
 
 	DBusMessageIter reply_args;
-	dbus_message_iter_init (reply, &reply_args);
 	DBusMessageIter variant_iter;
-	dbus_message_iter_recurse (&reply_args, &variant_iter);
-	dbus_bool_t accelerometer;
-	dbus_message_iter_get_basic (&variant_iter, &accelerometer);
+	if (dbus_message_iter_init (reply, &reply_args) &&
+		dbus_message_iter_get_arg_type (&reply_args) == DBUS_TYPE_VARIANT) {
+		dbus_message_iter_recurse (&reply_args, &variant_iter);
+		if (dbus_message_iter_get_arg_type (&variant_iter) == DBUS_TYPE_BOOLEAN)
+			dbus_message_iter_get_basic (&variant_iter, &accelerometer);
+	}
 	dbus_message_unref (reply);
 
-	return accelerometer;
+	if (accelerometer) {
+		log_info("This system has a gyro-sensor");
+		gyro_enable (term);
+	} else {
+		log_info("This system has NO gyro-sensor");
+	}
 }
 
-void call_method (DBusConnection* connection, const char* method)
+// asks the sensor-proxy for an accelerometer without waiting for the answer
+static void query_gyro (struct kmscon_terminal* term)
 {
-	DBusMessage* message = dbus_message_new_method_call (DESTINATION,
-														 SENSOR_PATH,
-														 SENSOR_INTERFACE,
-														 method);
+	DBusConnection* connection = kmscon_dbus_get_connection(term->dbus);
 
-	dbus_uint32_t serial;
-	dbus_bool_t success = dbus_connection_send (connection, message, &serial);
-
-	if (!success) {
-		log_info("There was an error with the message call '%s'", method);
+	if (!connection) {
+		return;
 	}
 
-	dbus_message_unref (message);
-}
+	DBusMessage* message = dbus_message_new_method_call (DESTINATION,
+														 SENSOR_PATH,
+														 FDO_PROPS_INTERFACE,
+														 FDO_GET_METHOD);
+	if (!message) {
+		return;
+	}
 
-void dbus_gyro_query_timer_cb(struct ev_timer *timer, uint64_t num, void *data)
-{
-	if (!data) {
-		log_warn(" No valid pointer passed to dbus_gyro_query_timer_cb().");
+	const char* interface = SENSOR_INTERFACE;
+	DBusMessageIter args;
+	dbus_message_iter_init_append (message, &args);
+	dbus_message_iter_append_basic (&args, DBUS_TYPE_STRING, &interface);
+	dbus_message_iter_append_basic (&args, DBUS_TYPE_STRING, &PROPERTY_HAS_GYRO);
+
+	if (!dbus_connection_send_with_reply (connection,
+										  message,
+										  &term->gyro_pending,
+										  DBUS_TIMEOUT_USE_DEFAULT) ||
+		!term->gyro_pending) {
+		log_info("Cannot query sensor-proxy");
+		dbus_message_unref (message);
 		return;
 	}
+	dbus_message_unref (message);
 
-	DBusConnection* dbus_connection = (DBusConnection*) data;
-	dbus_connection_read_write_dispatch (dbus_connection, 1);
+	if (!dbus_pending_call_set_notify (term->gyro_pending,
+									   has_gyro_reply,
+									   term,
+									   NULL)) {
+		dbus_pending_call_cancel (term->gyro_pending);
+		dbus_pending_call_unref (term->gyro_pending);
+		term->gyro_pending = NULL;
+	}
 }
 
 static void do_redraw_screen(struct screen *scr)
 {
-	int ret;
+	int ret, buf;
+	tsm_age_t age = 0;
+	const struct uterm_video_rect *rects = NULL;
+	size_t num = 0;
 
 	if (!scr->term->awake)
 		return;
 
 	scr->pending = false;
-	do_clear_margins(scr);
 
-	kmscon_text_prepare(scr->txt);
-	tsm_screen_draw(scr->term->console, kmscon_text_draw_cb, scr->txt);
-	kmscon_text_render(scr->txt);
+	buf = uterm_display_use(scr->disp, NULL);
+	if (buf >= 0 && buf < 2 && uterm_display_preserves_buffers(scr->disp))
+		age = scr->age[buf];
+	else
+		buf = -1;
+
+	if (!age)
+		do_clear_margins(scr);
+
+	ret = kmscon_text_prepare(scr->txt, age);
+	age = tsm_screen_draw(scr->term->console, kmscon_text_draw_cb,
+			      scr->txt);
+	if (!ret)
+		ret = kmscon_text_render(scr->txt);
+	if (!ret)
+		kmscon_text_get_damage(scr->txt, &rects, &num);
+	if (buf >= 0)
+		scr->age[buf] = ret ? 0 : age;
 
 	// deal with mapping normalized coords to character-cell coords
 	kmscon_mouse_set_mapping(scr->term->mouse, scr->disp, scr->txt);
@@ -456,7 +545,7 @@ static void do_redraw_screen(struct screen *scr)
 	handle_mouse_random_selection(scr->term->mouse, scr->term);
 	handle_mouse_drawing(scr->term->mouse, scr->txt);
 
-	ret = uterm_display_swap(scr->disp, false);
+	ret = uterm_display_swap_damage(scr->disp, false, rects, num);
 	if (ret) {
 		log_warning("cannot swap display %p", scr->disp);
 		return;
@@ -490,6 +579,49 @@ static void redraw_all(struct kmscon_terminal *term)
 	}
 }
 
+static void redraw_idle(struct ev_eloop *eloop, void *unused, void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	redraw_all(term);
+}
+
+/*
+ * Application output does not redraw directly. Instead, a redraw is scheduled
+ * as idle callback so all data that is available on the pty is parsed first.
+ * Screens that are still swapping delay the redraw until the page-flip, so we
+ * draw at most once per vblank and skip intermediate states during floods.
+ * The pending flag is only cleared by drawing, so the final state is always
+ * shown.
+ */
+static void schedule_redraw(struct kmscon_terminal *term)
+{
+	int ret;
+
+	if (!term->awake)
+		return;
+
+	ret = ev_eloop_register_idle_cb(term->eloop, redraw_idle, term,
+					EV_ONESHOT | EV_SINGLE);
+	if (ret) {
+		log_warning("cannot schedule redraw: %d", ret);
+		redraw_all(term);
+	}
+}
+
+/*
+ * Fonts may rasterize new glyphs in the background and hand out blank
+ * placeholders meanwhile. Cells drawn with a placeholder did not change as far
+ * as libtsm is concerned, so all screens are damaged before redrawing.
+ */
+static void glyph_event(struct ev_counter *cnt, uint64_t num, void *data)
+{
+	struct kmscon_terminal *term = data;
+
+	damage_all(term);
+	schedule_redraw(term);
+}
+
 static void redraw_all_test(struct kmscon_terminal *term)
 {
 	struct shl_dlist *iter;
@@ -502,6 +634,8 @@ static void redraw_all_test(struct kmscon_terminal *term)
 		scr = shl_dlist_entry(iter, struct screen, list);
 		if (uterm_display_is_swapping(scr->disp))
 			scr->swapping = true;
+		/* someone else might have drawn to our buffers meanwhile */
+		damage_screen(scr);
 		redraw_screen(scr);
 	}
 }
@@ -554,6 +688,7 @@ static void terminal_resize(struct kmscon_terminal *term,
 
 	tsm_screen_resize(term->console, term->min_cols, term->min_rows);
 	kmscon_pty_resize(term->pty, term->min_cols, term->min_rows);
+	damage_all(term);
 	redraw_all(term);
 }
 
@@ -564,6 +699,8 @@ static int font_set(struct kmscon_terminal *term)
 	struct shl_dlist *iter;
 	struct screen *ent;
 
+	kmscon_font_set_cache_budget((size_t)term->conf->glyph_cache << 20);
+
 	term->font_attr.bold = false;
 	ret = kmscon_font_find(&font, &term->font_attr,
 			       term->conf->font_engine);
@@ -593,6 +730,7 @@ static int font_set(struct kmscon_terminal *term)
 		if (ret)
 			log_warning("cannot change text-renderer font: %d",
 				    ret);
+		damage_screen(ent);
 
 		terminal_resize(term,
 				kmscon_text_get_cols(ent->txt),
@@ -610,6 +748,7 @@ static void rotate_cw_screen(struct screen *scr)
 	orientation = (orientation + 1) % ORIENTATION_MAX;
 	if (orientation == ORIENTATION_UNDEFINED) orientation = ORIENTATION_NORMAL;
 	kmscon_text_rotate(scr->txt, orientation);
+	damage_screen(scr);
 }
 
 static void rotate_cw_all(struct kmscon_terminal *term)
@@ -636,6 +775,7 @@ static void rotate_ccw_screen(struct screen *scr)
 	orientation = (orientation - 1) % ORIENTATION_MAX;
 	if (orientation == ORIENTATION_UNDEFINED) orientation = ORIENTATION_LEFT;
 	kmscon_text_rotate(scr->txt, orientation);
+	damage_screen(scr);
 }
 
 static void rotate_ccw_all(struct kmscon_terminal *term)
@@ -699,6 +839,15 @@ static int add_display(struct kmscon_terminal *term, struct uterm_display *disp)
 		goto err_cb;
 	}
 
+	kmscon_text_set_atlas_budget(scr->txt,
+				     (size_t)term->conf->atlas_budget << 20);
+	kmscon_text_set_glyph_budget(scr->txt,
+				     (size_t)term->conf->glyph_cache << 20);
+	ret = uterm_display_set_tile_budget(scr->disp,
+					(size_t)term->conf->tile_cache << 20);
+	if (ret)
+		log_warning("cannot create tile cache: %d", ret);
+
 	ret = kmscon_text_set(scr->txt, term->font, term->bold_font,
 			      scr->disp);
 	if (ret) {
@@ -779,6 +928,7 @@ static void input_event(struct uterm_input *input,
 			void *data)
 {
 	struct kmscon_terminal *term = data;
+	unsigned long writes;
 
 	if (!term->opened || !term->awake || ev->handled)
 		return;
@@ -852,10 +1002,13 @@ static void input_event(struct uterm_input *input,
 	if (ev->num_syms > 1)
 		return;
 
+	writes = term->pty_writes;
 	if (tsm_vte_handle_keyboard(term->vte, ev->keysyms[0], ev->ascii,
 				    ev->mods, ev->codepoints[0])) {
 		tsm_screen_sb_reset(term->console);
 		redraw_all(term);
+		/* keys that send nothing have no echo to wait for */
+		term->echo = term->pty_writes != writes;
 		ev->handled = true;
 	}
 }
@@ -907,6 +1060,9 @@ static void terminal_destroy(struct kmscon_terminal *term)
 	terminal_close(term);
 	rm_all_screens(term);
 	uterm_input_unregister_cb(term->input, input_event, term);
+	ev_eloop_unregister_idle_cb(term->eloop, redraw_idle, term, EV_SINGLE);
+	kmscon_font_remove_notifier(term->glyph_cnt);
+	ev_eloop_rm_counter(term->glyph_cnt);
 	ev_eloop_rm_fd(term->ptyfd);
 	kmscon_pty_unref(term->pty);
 	kmscon_font_unref(term->bold_font);
@@ -915,9 +1071,8 @@ static void terminal_destroy(struct kmscon_terminal *term)
 	tsm_screen_unref(term->console);
 	uterm_input_unref(term->input);
 	ev_eloop_unref(term->eloop);
-	call_method (term->dbus_connection, GYRO_RELEASE_METHOD);
-	dbus_error_free (&term->dbus_error);
-	dbus_connection_unref (term->dbus_connection);
+	gyro_disable(term);
+	kmscon_dbus_unref(term->dbus);
 	free(term);
 }
 
@@ -963,7 +1118,14 @@ static void pty_input(struct kmscon_pty *pty, const char *u8, size_t len,
 		terminal_open(term);
 	} else {
 		tsm_vte_input(term->vte, u8, len);
-		redraw_all(term);
+
+		/* draw the echo of keyboard input right away */
+		if (term->echo) {
+			term->echo = false;
+			redraw_all(term);
+		} else {
+			schedule_redraw(term);
+		}
 	}
 }
 
@@ -979,6 +1141,7 @@ static void write_event(struct tsm_vte *vte, const char *u8, size_t len,
 {
 	struct kmscon_terminal *term = data;
 
+	++term->pty_writes;
 	kmscon_pty_write(term->pty, u8, len);
 }
 
@@ -1069,10 +1232,19 @@ int kmscon_terminal_register(struct kmscon_session **out,
 	if (ret)
 		goto err_pty;
 
-	ret = uterm_input_register_cb(term->input, input_event, term);
+	ret = ev_eloop_new_counter(term->eloop, &term->glyph_cnt, glyph_event,
+				   term);
 	if (ret)
 		goto err_ptyfd;
 
+	ret = kmscon_font_add_notifier(term->glyph_cnt);
+	if (ret)
+		goto err_glyph_cnt;
+
+	ret = uterm_input_register_cb(term->input, input_event, term);
+	if (ret)
+		goto err_notifier;
+
 	ret = kmscon_seat_register_session(seat, &term->session, session_event,
 					   term);
 	if (ret) {
@@ -1080,59 +1252,9 @@ int kmscon_terminal_register(struct kmscon_session **out,
 		goto err_input;
 	}
 
-	dbus_error_init (&term->dbus_error);
-	term->dbus_connection = dbus_bus_get (DBUS_BUS_SYSTEM, &term->dbus_error);
-
-	if (has_gyro (term->dbus_connection, &term->dbus_error)) {
-		term->has_gyro = true;
-		log_info("This system has a gyro-sensor");
-		call_method (term->dbus_connection, GYRO_CLAIM_METHOD);
-	} else {
-		term->has_gyro = false;
-		log_info("This system has NO gyro-sensor");
-	}
-
-	if (term->has_gyro) {
-		dbus_bus_add_match (term->dbus_connection,
-							"type='signal',\
-							interface='org.freedesktop.DBus.Properties',\
-							member='PropertiesChanged',\
-							sender='net.hadess.SensorProxy'",
-							&term->dbus_error);
-
-		dbus_bool_t result = dbus_connection_add_filter(term->dbus_connection,
-														properties_changed_cb,
-														term,
-														NULL);
-
-		if (!result) {
-			log_info("Failed to add filter to connection");
-		}
-
-		// dbus-gyro-query timer
-		term->dbus_gyro_query_timer_spec.it_interval.tv_sec  = 0;
-		term->dbus_gyro_query_timer_spec.it_interval.tv_nsec = 200*1000*1000;
-		term->dbus_gyro_query_timer_spec.it_value.tv_sec  = 0;
-		term->dbus_gyro_query_timer_spec.it_value.tv_nsec = 200*1000*1000;
-
-		ret = ev_timer_new (&term->dbus_gyro_query_timer,
-							&term->dbus_gyro_query_timer_spec,
-							dbus_gyro_query_timer_cb,
-							term->dbus_connection,
-							NULL,
-							NULL);
-		if (ret) {
-			log_error("Cannot create dbus-gyro-query timer: %d", ret);
-			goto err_free;
-		}
-		ev_timer_enable(term->dbus_gyro_query_timer);
-
-		ret = ev_eloop_add_timer(term->eloop, term->dbus_gyro_query_timer);
-		if (ret) {
-			log_error("Cannot add dbus-gyro-query timer to event-loop: %d", ret);
-			goto err_free;
-		}
-	}
+	term->dbus = kmscon_seat_get_dbus(seat);
+	kmscon_dbus_ref(term->dbus);
+	query_gyro(term);
 
 	ev_eloop_ref(term->eloop);
 	uterm_input_ref(term->input);
@@ -1142,6 +1264,10 @@ int kmscon_terminal_register(struct kmscon_session **out,
 
 err_input:
 	uterm_input_unregister_cb(term->input, input_event, term);
+err_notifier:
+	kmscon_font_remove_notifier(term->glyph_cnt);
+err_glyph_cnt:
+	ev_eloop_rm_counter(term->glyph_cnt);
 err_ptyfd:
 	ev_eloop_rm_fd(term->ptyfd);
 err_pty:
@@ -1154,9 +1280,6 @@ err_vte:
 err_con:
 	tsm_screen_unref(term->console);
 err_free:
-	call_method (term->dbus_connection, GYRO_RELEASE_METHOD);
-	dbus_error_free (&term->dbus_error);
-	dbus_connection_unref (term->dbus_connection);
 	free(term);
 	return ret;
 }
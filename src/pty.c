@@ -41,10 +41,14 @@
 #include "shl_log.h"
 #include "shl_misc.h"
 #include "shl_ring.h"
+#include "shl_timer.h"
 
 #define LOG_SUBSYSTEM "pty"
 
 #define KMSCON_NREAD 16384
+/* time in usecs that we read and parse application data before we return to
+ * the event loop so pending page-flips and input can be handled */
+#define KMSCON_READ_BUDGET 8000
 
 struct kmscon_pty {
 	unsigned long ref;
@@ -443,13 +447,15 @@ static int send_buf(struct kmscon_pty *pty)
 
 static int read_buf(struct kmscon_pty *pty)
 {
-	ssize_t len, num;
+	struct shl_timer timer;
+	bool budget = true;
+	ssize_t len;
 	int mask;
 
-	/* Use a maximum of 50 steps to avoid staying here forever.
-	 * TODO: recheck where else a user might flush our queues and try to
-	 * install an explicit policy. */
-	num = 50;
+	/* Read as much as we can get during KMSCON_READ_BUDGET to avoid staying
+	 * here forever. The input callback only parses the data, drawing is
+	 * deferred so a flood is parsed in large batches. */
+	shl_timer_reset(&timer);
 	do {
 		len = read(pty->fd, pty->io_buf, sizeof(pty->io_buf));
 		if (len > 0) {
@@ -464,9 +470,12 @@ static int read_buf(struct kmscon_pty *pty)
 				  pty->child, errno);
 			break;
 		}
-	} while (len > 0 && --num);
 
-	if (!num) {
+		if (shl_timer_elapsed(&timer) >= KMSCON_READ_BUDGET)
+			budget = false;
+	} while (len > 0 && budget);
+
+	if (!budget) {
 		log_debug("cannot read application data fast enough");
 
 		/* We are edge-triggered so update the mask to get the
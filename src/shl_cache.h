@@ -0,0 +1,273 @@
+/*
+ * shl - Bounded LRU Cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * A hash table with a memory budget
+ * Each value is inserted together with its size in bytes. Once the sum of all
+ * sizes exceeds the budget, the least recently used values are freed. Values
+ * that were inserted or found during the current frame are never freed, as
+ * callers may still hold pointers to them, so the budget may be exceeded until
+ * the frame is advanced. A budget of 0 is unlimited.
+ * No locking is done, this is up to the caller.
+ */
+
+#ifndef SHL_CACHE_H
+#define SHL_CACHE_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_dlist.h"
+#include "shl_hashtable.h"
+
+struct shl_cache_stats {
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	unsigned int num;		/* number of cached values */
+	size_t size;			/* sum of their sizes */
+	size_t budget;
+};
+
+typedef bool (*shl_cache_match_cb) (const void *value, const void *data);
+
+struct shl_cache_entry {
+	struct shl_dlist list;
+	uint64_t key;
+	void *value;
+	size_t size;
+	unsigned long frame;
+};
+
+struct shl_cache {
+	struct shl_hashtable *tbl;
+	struct shl_dlist lru;		/* most recently used first */
+	shl_free_cb free_value;
+	unsigned long frame;
+	struct shl_cache_stats stats;
+};
+
+static inline int shl_cache_new(struct shl_cache **out, size_t budget,
+				shl_free_cb free_value)
+{
+	struct shl_cache *cache;
+	int ret;
+
+	if (!out)
+		return -EINVAL;
+
+	cache = malloc(sizeof(*cache));
+	if (!cache)
+		return -ENOMEM;
+	memset(cache, 0, sizeof(*cache));
+	shl_dlist_init(&cache->lru);
+	cache->free_value = free_value;
+	cache->stats.budget = budget;
+
+	ret = shl_hashtable_new(&cache->tbl, shl_direct_hash,
+				shl_direct_equal, NULL);
+	if (ret) {
+		free(cache);
+		return ret;
+	}
+
+	*out = cache;
+	return 0;
+}
+
+static inline void shl_cache__drop(struct shl_cache *cache,
+				   struct shl_cache_entry *entry)
+{
+	shl_dlist_unlink(&entry->list);
+	shl_hashtable_remove(cache->tbl, entry->key);
+	cache->stats.size -= entry->size;
+	--cache->stats.num;
+	if (cache->free_value)
+		cache->free_value(entry->value);
+	free(entry);
+}
+
+/* frees least recently used values until the cache fits into its budget */
+static inline void shl_cache__trim(struct shl_cache *cache)
+{
+	struct shl_cache_entry *entry;
+
+	if (!cache->stats.budget)
+		return;
+
+	while (cache->stats.size > cache->stats.budget &&
+	       !shl_dlist_empty(&cache->lru)) {
+		entry = shl_dlist_last(&cache->lru, struct shl_cache_entry,
+				       list);
+		/* all others were used during this frame, too */
+		if (entry->frame == cache->frame)
+			break;
+
+		shl_cache__drop(cache, entry);
+		++cache->stats.evictions;
+	}
+}
+
+static inline void shl_cache_clear(struct shl_cache *cache)
+{
+	struct shl_cache_entry *entry;
+
+	if (!cache)
+		return;
+
+	while (!shl_dlist_empty(&cache->lru)) {
+		entry = shl_dlist_first(&cache->lru, struct shl_cache_entry,
+					list);
+		shl_cache__drop(cache, entry);
+	}
+}
+
+static inline void shl_cache_free(struct shl_cache *cache)
+{
+	if (!cache)
+		return;
+
+	shl_cache_clear(cache);
+	shl_hashtable_free(cache->tbl);
+	free(cache);
+}
+
+static inline void shl_cache_set_budget(struct shl_cache *cache, size_t budget)
+{
+	if (!cache)
+		return;
+
+	cache->stats.budget = budget;
+	shl_cache__trim(cache);
+}
+
+/* Values used during older frames may be freed from now on. @frame is any
+ * value that differs from the previous frame, like a global frame counter. */
+static inline void shl_cache_set_frame(struct shl_cache *cache,
+				       unsigned long frame)
+{
+	if (!cache || cache->frame == frame)
+		return;
+
+	cache->frame = frame;
+	shl_cache__trim(cache);
+}
+
+static inline void shl_cache_next_frame(struct shl_cache *cache)
+{
+	if (cache)
+		shl_cache_set_frame(cache, cache->frame + 1);
+}
+
+/* Like shl_cache_find() but a value for which @match returns false counts as a
+ * miss, too. This is for keys that are only hashes of the real identity. */
+static inline bool shl_cache_find_match(struct shl_cache *cache, void **out,
+					uint64_t key, shl_cache_match_cb match,
+					const void *data)
+{
+	struct shl_cache_entry *entry;
+
+	if (!cache)
+		return false;
+
+	if (!shl_hashtable_find(cache->tbl, (void**)&entry, key) ||
+	    (match && !match(entry->value, data))) {
+		++cache->stats.misses;
+		return false;
+	}
+
+	++cache->stats.hits;
+	entry->frame = cache->frame;
+	shl_dlist_unlink(&entry->list);
+	shl_dlist_link(&cache->lru, &entry->list);
+
+	if (out)
+		*out = entry->value;
+	return true;
+}
+
+static inline bool shl_cache_find(struct shl_cache *cache, void **out,
+				  uint64_t key)
+{
+	return shl_cache_find_match(cache, out, key, NULL, NULL);
+}
+
+/* Returns -EALREADY if @key is cached already. On failure, @value is not
+ * freed. */
+static inline int shl_cache_insert(struct shl_cache *cache, uint64_t key,
+				   void *value, size_t size)
+{
+	struct shl_cache_entry *entry;
+	int ret;
+
+	if (!cache)
+		return -EINVAL;
+	if (shl_hashtable_find(cache->tbl, NULL, key))
+		return -EALREADY;
+
+	entry = malloc(sizeof(*entry));
+	if (!entry)
+		return -ENOMEM;
+	entry->key = key;
+	entry->value = value;
+	entry->size = size;
+	entry->frame = cache->frame;
+
+	ret = shl_hashtable_insert(cache->tbl, key, entry);
+	if (ret) {
+		free(entry);
+		return ret;
+	}
+
+	shl_dlist_link(&cache->lru, &entry->list);
+	cache->stats.size += size;
+	++cache->stats.num;
+	shl_cache__trim(cache);
+
+	return 0;
+}
+
+static inline void shl_cache_remove(struct shl_cache *cache, uint64_t key)
+{
+	struct shl_cache_entry *entry;
+
+	if (!cache)
+		return;
+
+	if (shl_hashtable_find(cache->tbl, (void**)&entry, key))
+		shl_cache__drop(cache, entry);
+}
+
+static inline void shl_cache_get_stats(struct shl_cache *cache,
+				       struct shl_cache_stats *stats)
+{
+	if (cache && stats)
+		memcpy(stats, &cache->stats, sizeof(*stats));
+}
+
+#endif /* SHL_CACHE_H */
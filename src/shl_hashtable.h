@@ -98,7 +98,7 @@ static inline int shl_hashtable_new(struct shl_hashtable **out,
 	return 0;
 }
 
-static inline void shl_hashtable_free(struct shl_hashtable *tbl)
+static inline void shl_hashtable_clear(struct shl_hashtable *tbl)
 {
 	struct htable_iter i;
 	struct shl_hashentry *entry;
@@ -116,6 +116,14 @@ static inline void shl_hashtable_free(struct shl_hashtable *tbl)
 	}
 
 	htable_clear(&tbl->tbl);
+}
+
+static inline void shl_hashtable_free(struct shl_hashtable *tbl)
+{
+	if (!tbl)
+		return;
+
+	shl_hashtable_clear(tbl);
 	free(tbl);
 }
 
@@ -160,6 +168,9 @@ static inline void shl_hashtable_remove(struct shl_hashtable *tbl, uint64_t key)
 	     entry = htable_nextval(&tbl->tbl, &i, hash)) {
 		if (tbl->equal_cb(key, entry->key)) {
 			htable_delval(&tbl->tbl, &i);
+			if (tbl->free_value)
+				tbl->free_value(entry->value);
+			free(entry);
 			return;
 		}
 	}
@@ -235,6 +235,35 @@ void kmscon_text_unref(struct kmscon_text *text)
 	free(text);
 }
 
+/* Places the decoration lines around the baseline of @font. Lines are about a
+ * sixteenth of the cell high and are always kept inside of the cell. */
+static void set_decorations(struct kmscon_text *txt,
+			    const struct kmscon_font *font)
+{
+	unsigned int h = font->attr.height, base = font->baseline, t, y;
+
+	t = h / 16 ? h / 16 : 1;
+	if (t > h)
+		t = h;
+	if (base > h - t)
+		base = h - t;
+
+	/* underlines start one pixel below the baseline and the second line
+	 * of double underlines one line-height further down */
+	y = base + 1;
+	if (y + 3 * t > h)
+		y = h >= 3 * t ? h - 3 * t : 0;
+	txt->deco[0].y = y;
+	txt->deco[0].height = t;
+	txt->deco[1].y = y + 2 * t <= h - t ? y + 2 * t : h - t;
+	txt->deco[1].height = t;
+
+	/* strikethrough at about half the height of lower-case letters */
+	y = base * 3 / 4;
+	txt->deco[2].y = y >= t / 2 ? y - t / 2 : 0;
+	txt->deco[2].height = t;
+}
+
 /**
  * kmscon_text_set:
  * @txt: Valid text-renderer object
@@ -272,6 +301,7 @@ int kmscon_text_set(struct kmscon_text *txt,
 	txt->font = font;
 	txt->bold_font = bold_font;
 	txt->disp = disp;
+	set_decorations(txt, font);
 
 	if (txt->ops->set) {
 		ret = txt->ops->set(txt);
@@ -279,10 +309,19 @@ int kmscon_text_set(struct kmscon_text *txt,
 			txt->font = NULL;
 			txt->bold_font = NULL;
 			txt->disp = NULL;
+			txt->damage = false;
 			return ret;
 		}
 	}
 
+	if (txt->damage) {
+		txt->rects = malloc(sizeof(*txt->rects) * txt->rows);
+		if (!txt->rects) {
+			log_warning("cannot allocate damage-tracking memory");
+			txt->damage = false;
+		}
+	}
+
 	kmscon_font_ref(txt->font);
 	kmscon_font_ref(txt->bold_font);
 	uterm_display_ref(txt->disp);
@@ -316,6 +355,18 @@ void kmscon_text_unset(struct kmscon_text *txt)
 	txt->cols = 0;
 	txt->rows = 0;
 	txt->rendering = false;
+	txt->damage = false;
+	txt->age = 0;
+	free(txt->rects);
+	txt->rects = NULL;
+	free(txt->run);
+	free(txt->run_attrs);
+	free(txt->run_chars);
+	txt->run = NULL;
+	txt->run_attrs = NULL;
+	txt->run_chars = NULL;
+	txt->run_size = 0;
+	txt->run_num = 0;
 }
 
 /**
@@ -356,6 +407,61 @@ unsigned int kmscon_text_get_rows(struct kmscon_text *txt)
 	return txt->rows;
 }
 
+/**
+ * kmscon_text_set_atlas_budget:
+ * @txt: valid text renderer
+ * @budget: memory in bytes, 0 is unlimited
+ *
+ * Backends that cache glyphs in video memory (like gltex) evict the least
+ * recently used glyphs instead of allocating new atlases once their atlases
+ * would exceed @budget. This must be called before kmscon_text_set().
+ */
+void kmscon_text_set_atlas_budget(struct kmscon_text *txt, size_t budget)
+{
+	if (!txt)
+		return;
+
+	txt->atlas_budget = budget;
+}
+
+/**
+ * kmscon_text_set_glyph_budget:
+ * @txt: valid text renderer
+ * @budget: memory in bytes, 0 is unlimited
+ *
+ * Backends that keep their own copies of glyphs in system memory (like pixman)
+ * evict the least recently used glyphs once they would exceed @budget. Glyphs
+ * that are drawn in the current frame are never evicted. This must be called
+ * before kmscon_text_set().
+ */
+void kmscon_text_set_glyph_budget(struct kmscon_text *txt, size_t budget)
+{
+	if (!txt)
+		return;
+
+	txt->glyph_budget = budget;
+}
+
+/**
+ * kmscon_text_get_atlas_stats:
+ * @txt: valid text renderer
+ * @stats: statistics are stored here
+ *
+ * Returns: 0 on success, -EOPNOTSUPP if the backend has no glyph atlases
+ */
+int kmscon_text_get_atlas_stats(struct kmscon_text *txt,
+				struct kmscon_text_atlas_stats *stats)
+{
+	if (!txt || !stats)
+		return -EINVAL;
+	if (!txt->ops->get_atlas_stats || !txt->disp)
+		return -EOPNOTSUPP;
+
+	memset(stats, 0, sizeof(*stats));
+	txt->ops->get_atlas_stats(txt, stats);
+	return 0;
+}
+
 /**
  * kmscon_text_get_orientation:
  * @txt: valid text renderer
@@ -405,9 +511,35 @@ int kmscon_text_rotate(struct kmscon_text *txt, unsigned int orientation)
 	return ret;
 }
 
+/* Without a run buffer, kmscon_text_draw_cb() draws each cell on its own. */
+static void alloc_run(struct kmscon_text *txt)
+{
+	free(txt->run);
+	free(txt->run_attrs);
+	free(txt->run_chars);
+	txt->run = malloc(sizeof(*txt->run) * txt->cols);
+	txt->run_attrs = malloc(sizeof(*txt->run_attrs) * txt->cols);
+	txt->run_chars = malloc(sizeof(*txt->run_chars) * txt->cols);
+
+	if (!txt->run || !txt->run_attrs || !txt->run_chars) {
+		log_warning("cannot allocate run buffer");
+		free(txt->run);
+		free(txt->run_attrs);
+		free(txt->run_chars);
+		txt->run = NULL;
+		txt->run_attrs = NULL;
+		txt->run_chars = NULL;
+		txt->run_size = 0;
+		return;
+	}
+
+	txt->run_size = txt->cols;
+}
+
 /**
  * kmscon_text_prepare:
  * @txt: valid text renderer
+ * @age: age of the frame that is currently stored in the target buffer
  *
  * This starts a rendering-round. When rendering a console via a text renderer,
  * you have to call this first, then render all your glyphs via
@@ -416,15 +548,36 @@ int kmscon_text_rotate(struct kmscon_text *txt, unsigned int orientation)
  * between, you need to restart rendering by calling kmscon_text_prepare() again
  * and redoing everything from the beginning.
  *
+ * @age is the value that tsm_screen_draw() returned when the target buffer was
+ * last drawn to. If the backend and the display support partial redraws,
+ * kmscon_text_draw_cb() skips all cells that did not change since then. Pass 0
+ * to redraw everything.
+ *
  * Returns: 0 on success, negative error code on failure.
  */
-int kmscon_text_prepare(struct kmscon_text *txt)
+int kmscon_text_prepare(struct kmscon_text *txt, tsm_age_t age)
 {
 	int ret = 0;
 
 	if (!txt || !txt->font || !txt->disp)
 		return -EINVAL;
 
+	if (txt->damage && uterm_display_preserves_buffers(txt->disp))
+		txt->age = age;
+	else
+		txt->age = 0;
+
+	if (txt->age)
+		memset(txt->rects, 0, sizeof(*txt->rects) * txt->rows);
+
+	/* rotation may change the number of columns */
+	txt->run_num = 0;
+	if (txt->run_size < txt->cols)
+		alloc_run(txt);
+
+	/* glyphs of the previous frame may be evicted by the fonts from now on */
+	kmscon_font_next_frame();
+
 	txt->rendering = true;
 	if (txt->ops->prepare)
 		ret = txt->ops->prepare(txt);
@@ -466,6 +619,110 @@ int kmscon_text_draw(struct kmscon_text *txt,
 	return txt->ops->draw(txt, id, ch, len, width, posx, posy, attr);
 }
 
+/**
+ * kmscon_text_draw_run:
+ * @txt: valid text renderer
+ * @posx: X-position of the first cell
+ * @posy: Y-position of the cells
+ * @cells: cells to draw
+ * @attrs: attributes of each cell in @cells
+ * @num: number of cells in @cells
+ *
+ * This is like kmscon_text_draw() but draws @num consecutive cells of a single
+ * row at once. The cell @cells[i] is drawn at column @posx + i. The second
+ * half of a wide character is passed as a cell with a width of 0. Cells beyond
+ * the last column are ignored.
+ * Backends that do not draw runs get each cell via kmscon_text_draw().
+ *
+ * Returns: 0 on success or negative error code if a cell couldn't be drawn.
+ */
+int kmscon_text_draw_run(struct kmscon_text *txt,
+			 unsigned int posx, unsigned int posy,
+			 const struct kmscon_text_cell *cells,
+			 const struct tsm_screen_attr *attrs,
+			 size_t num)
+{
+	size_t i;
+	int ret, err = 0;
+
+	if (!txt || !txt->rendering || !cells || !attrs)
+		return -EINVAL;
+	if (posx >= txt->cols || posy >= txt->rows)
+		return -EINVAL;
+
+	if (num > txt->cols - posx)
+		num = txt->cols - posx;
+
+	if (txt->ops->draw_run)
+		return txt->ops->draw_run(txt, posx, posy, cells, attrs, num);
+
+	for (i = 0; i < num; ++i) {
+		ret = txt->ops->draw(txt, cells[i].id, cells[i].ch,
+				     cells[i].len, cells[i].width,
+				     posx + i, posy, &attrs[i]);
+		if (ret)
+			err = ret;
+	}
+
+	return err;
+}
+
+/* extends the damaged area of row @posy by the cells @posx to @posx + @width */
+static void add_damage(struct kmscon_text *txt, unsigned int posx,
+		       unsigned int posy, unsigned int width)
+{
+	struct uterm_video_rect *r;
+	unsigned int x, w;
+
+	x = posx * txt->font->attr.width;
+	w = width * txt->font->attr.width;
+	r = &txt->rects[posy];
+	if (!r->width) {
+		r->x = x;
+		r->y = posy * txt->font->attr.height;
+		r->width = w;
+		r->height = txt->font->attr.height;
+	} else {
+		if (x + w > r->x + r->width)
+			r->width = x + w - r->x;
+		if (x < r->x) {
+			r->width += r->x - x;
+			r->x = x;
+		}
+	}
+}
+
+/* draws the cells queued by kmscon_text_draw_cb() */
+static int flush_run(struct kmscon_text *txt)
+{
+	unsigned int i, start, end;
+	int ret;
+
+	if (!txt->run_num)
+		return 0;
+
+	/* cells that failed do not stop the rest of the run from being drawn */
+	ret = kmscon_text_draw_run(txt, txt->run_x, txt->run_y, txt->run,
+				   txt->run_attrs, txt->run_num);
+	if (txt->age) {
+		start = txt->cols;
+		end = 0;
+		for (i = 0; i < txt->run_num; ++i) {
+			if (!txt->run[i].width)
+				continue;
+			if (start > txt->run_x + i)
+				start = txt->run_x + i;
+			if (end < txt->run_x + i + txt->run[i].width)
+				end = txt->run_x + i + txt->run[i].width;
+		}
+		if (end > start)
+			add_damage(txt, start, txt->run_y, end - start);
+	}
+
+	txt->run_num = 0;
+	return ret;
+}
+
 /**
  * kmscon_text_render:
  * @txt: valid text renderer
@@ -482,6 +739,9 @@ int kmscon_text_render(struct kmscon_text *txt)
 	if (!txt || !txt->rendering)
 		return -EINVAL;
 
+	/* like tsm_screen_draw(), ignore cells that could not be drawn */
+	flush_run(txt);
+
 	if (txt->ops->render)
 		ret = txt->ops->render(txt);
 	txt->rendering = false;
@@ -489,6 +749,54 @@ int kmscon_text_render(struct kmscon_text *txt)
 	return ret;
 }
 
+/**
+ * kmscon_text_get_damage:
+ * @txt: valid text renderer
+ * @rects: output for the damaged rectangles
+ * @num: output for the number of rectangles in @rects
+ *
+ * After a rendering-round finished, this returns the regions of the display
+ * that were redrawn. Consecutive rows with equal horizontal extents are merged.
+ * The result can be passed to uterm_display_swap_damage() and is valid until
+ * the next call to kmscon_text_prepare().
+ * If everything was redrawn, @rects is set to NULL.
+ */
+void kmscon_text_get_damage(struct kmscon_text *txt,
+			    const struct uterm_video_rect **rects,
+			    size_t *num)
+{
+	struct uterm_video_rect *last, r;
+	unsigned int i;
+	size_t n;
+
+	if (!txt || !txt->age || !txt->rects) {
+		*rects = NULL;
+		*num = 0;
+		return;
+	}
+
+	/* compact in-place, txt->rects[i] is only needed until step i */
+	last = NULL;
+	n = 0;
+	for (i = 0; i < txt->rows; ++i) {
+		r = txt->rects[i];
+		if (!r.width)
+			continue;
+
+		if (last && last->x == r.x && last->width == r.width &&
+		    last->y + last->height == r.y) {
+			last->height += r.height;
+			continue;
+		}
+
+		last = &txt->rects[n++];
+		*last = r;
+	}
+
+	*rects = txt->rects;
+	*num = n;
+}
+
 /**
  * kmscon_text_render_pointer:
  * @txt: valid text renderer
@@ -532,8 +840,25 @@ void kmscon_text_abort(struct kmscon_text *txt)
 	if (txt->ops->abort)
 		txt->ops->abort(txt);
 	txt->rendering = false;
+	txt->run_num = 0;
 }
 
+/**
+ * kmscon_text_draw_cb:
+ * @con: screen that is drawn
+ * @age: age of the cell
+ * @data: text renderer
+ *
+ * Draw callback for tsm_screen_draw(). It skips cells that did not change since
+ * the frame that was passed to kmscon_text_prepare(). A cell-age of 0 means the
+ * age is unknown so such cells are always drawn.
+ * The other cells are collected into runs of consecutive cells of a row which
+ * are passed to kmscon_text_draw_run() once the run ends. The last run is drawn
+ * by kmscon_text_render(). Single characters are copied, combined characters
+ * point into the symbol table of libtsm which does not change while drawing.
+ *
+ * Returns: 0 on success or negative error code if a cell couldn't be drawn.
+ */
 int kmscon_text_draw_cb(struct tsm_screen *con,
 			uint64_t id, const uint32_t *ch, size_t len,
 			unsigned int width,
@@ -541,5 +866,47 @@ int kmscon_text_draw_cb(struct tsm_screen *con,
 			const struct tsm_screen_attr *attr,
 			tsm_age_t age, void *data)
 {
-	return kmscon_text_draw(data, id, ch, len, width, posx, posy, attr);
+	struct kmscon_text *txt = data;
+	struct kmscon_text_cell *cell;
+	unsigned int i;
+	int ret = 0;
+
+	if (txt->age && age && age <= txt->age)
+		return 0;
+
+	if (!txt->run_size) {
+		ret = kmscon_text_draw(txt, id, ch, len, width, posx, posy,
+				       attr);
+		if (!ret && txt->age && width && posy < txt->rows)
+			add_damage(txt, posx, posy, width);
+		return ret;
+	}
+
+	if (!txt->rendering || posx >= txt->cols || posy >= txt->rows ||
+	    !attr)
+		return -EINVAL;
+
+	if (txt->run_num && (posy != txt->run_y ||
+			     posx != txt->run_x + txt->run_num))
+		ret = flush_run(txt);
+
+	if (!txt->run_num) {
+		txt->run_x = posx;
+		txt->run_y = posy;
+	}
+
+	i = txt->run_num++;
+	cell = &txt->run[i];
+	cell->id = id;
+	cell->len = len;
+	cell->width = width;
+	if (len == 1) {
+		txt->run_chars[i] = *ch;
+		cell->ch = &txt->run_chars[i];
+	} else {
+		cell->ch = ch;
+	}
+	txt->run_attrs[i] = *attr;
+
+	return ret;
 }
@@ -35,6 +35,7 @@
 
 #include <errno.h>
 #include <libtsm.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include "font.h"
 #include "kmscon_module.h"
@@ -54,6 +55,27 @@ enum Orientation {
 struct kmscon_text;
 struct kmscon_text_ops;
 
+/* decorations, drawn by the text renderer on top of the glyphs */
+#define KMSCON_TEXT_UNDERLINE		0x01
+#define KMSCON_TEXT_DOUBLE_UNDERLINE	0x02
+#define KMSCON_TEXT_STRIKETHROUGH	0x04
+
+#define KMSCON_TEXT_MAX_SPANS 3
+
+/* a solid line across a cell, relative to the top of the cell */
+struct kmscon_text_span {
+	unsigned int y;
+	unsigned int height;
+};
+
+/* a cell of a run, see kmscon_text_draw_run() */
+struct kmscon_text_cell {
+	uint64_t id;
+	const uint32_t *ch;
+	size_t len;
+	unsigned int width;
+};
+
 struct kmscon_text {
 	unsigned long ref;
 	struct shl_register_record *record;
@@ -67,6 +89,38 @@ struct kmscon_text {
 	unsigned int rows;
 	bool rendering;
 	unsigned int orientation;
+
+	/* set by backends that can redraw single cells into a preserved buffer */
+	bool damage;
+	/* age of the frame in the current target buffer; 0 redraws everything */
+	tsm_age_t age;
+	/* pixel-area that was redrawn in each row during partial redraws */
+	struct uterm_video_rect *rects;
+
+	/* underline, second line of double underlines and strikethrough */
+	struct kmscon_text_span deco[3];
+
+	/* bytes of glyph-atlas memory a backend may use; 0 is unlimited */
+	size_t atlas_budget;
+	/* bytes of system memory a backend may use for its glyphs; 0 is unlimited */
+	size_t glyph_budget;
+
+	/* cells queued by kmscon_text_draw_cb() that form the current run */
+	struct kmscon_text_cell *run;
+	struct tsm_screen_attr *run_attrs;
+	uint32_t *run_chars;
+	unsigned int run_size;
+	unsigned int run_num;
+	unsigned int run_x;
+	unsigned int run_y;
+};
+
+struct kmscon_text_atlas_stats {
+	unsigned int atlases;		/* number of atlases */
+	size_t bytes;			/* memory used by all atlases */
+	unsigned int slots;		/* glyph-cells in all atlases */
+	unsigned int used;		/* glyph-cells holding a glyph */
+	unsigned long evictions;	/* glyphs dropped to make room */
 };
 
 struct kmscon_text_ops {
@@ -83,9 +137,16 @@ struct kmscon_text_ops {
 		     unsigned int width,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr);
+	int (*draw_run) (struct kmscon_text *txt,
+			 unsigned int posx, unsigned int posy,
+			 const struct kmscon_text_cell *cells,
+			 const struct tsm_screen_attr *attrs,
+			 size_t num);
 	int (*render) (struct kmscon_text *txt);
 	int (*render_pointer) (struct kmscon_text *txt, int cursor_x, int cursor_y);
 	void (*abort) (struct kmscon_text *txt);
+	void (*get_atlas_stats) (struct kmscon_text *txt,
+				 struct kmscon_text_atlas_stats *stats);
 };
 
 int kmscon_text_register(const struct kmscon_text_ops *ops);
@@ -102,22 +163,120 @@ int kmscon_text_set(struct kmscon_text *txt,
 void kmscon_text_unset(struct kmscon_text *txt);
 unsigned int kmscon_text_get_cols(struct kmscon_text *txt);
 unsigned int kmscon_text_get_rows(struct kmscon_text *txt);
+void kmscon_text_set_atlas_budget(struct kmscon_text *txt, size_t budget);
+void kmscon_text_set_glyph_budget(struct kmscon_text *txt, size_t budget);
+int kmscon_text_get_atlas_stats(struct kmscon_text *txt,
+				struct kmscon_text_atlas_stats *stats);
 
 unsigned int kmscon_text_get_orientation(struct kmscon_text *txt);
 int kmscon_text_rotate(struct kmscon_text *txt, unsigned int orientation);
 
-int kmscon_text_prepare(struct kmscon_text *txt);
+int kmscon_text_prepare(struct kmscon_text *txt, tsm_age_t age);
 int kmscon_text_draw(struct kmscon_text *txt,
 		     uint64_t id, const uint32_t *ch, size_t len,
 		     unsigned int width,
 		     unsigned int posx, unsigned int posy,
 		     const struct tsm_screen_attr *attr);
+int kmscon_text_draw_run(struct kmscon_text *txt,
+			 unsigned int posx, unsigned int posy,
+			 const struct kmscon_text_cell *cells,
+			 const struct tsm_screen_attr *attrs,
+			 size_t num);
 int kmscon_text_render(struct kmscon_text *txt);
+void kmscon_text_get_damage(struct kmscon_text *txt,
+			    const struct uterm_video_rect **rects,
+			    size_t *num);
 int kmscon_text_render_pointer(struct kmscon_text *txt,
 							   int cursor_x,
 							   int cursor_y);
 void kmscon_text_abort(struct kmscon_text *txt);
 
+/* fills @req to render @ch with the style of @attr */
+static inline void kmscon_text_glyph_req(struct kmscon_glyph_req *req,
+					 uint64_t id, const uint32_t *ch,
+					 size_t len,
+					 const struct tsm_screen_attr *attr)
+{
+	req->id = id;
+	req->ch = ch;
+	req->len = len;
+	req->style = 0;
+	if (attr->italic)
+		req->style |= KMSCON_GLYPH_ITALIC;
+}
+
+/* whether cells with these attributes look the same, ignoring blinking */
+static inline bool kmscon_text_same_style(const struct tsm_screen_attr *a,
+					  const struct tsm_screen_attr *b)
+{
+	return a->fr == b->fr && a->fg == b->fg && a->fb == b->fb &&
+	       a->br == b->br && a->bg == b->bg && a->bb == b->bb &&
+	       a->bold == b->bold && a->italic == b->italic &&
+	       a->underline == b->underline && a->inverse == b->inverse;
+}
+
+/* blank cells show nothing but their background and decorations; the second
+ * half of a wide character is not blank as its glyph covers it */
+static inline bool kmscon_text_is_blank(const struct kmscon_text_cell *cell)
+{
+	return !cell->len && cell->width;
+}
+
+/* Returns the end of the segment of a run that starts at cell @i. The cells of
+ * a segment have the same style and are either all blank or not. @width is set
+ * to the number of columns it covers, clipped to the screen. */
+static inline size_t kmscon_text_get_segment(const struct kmscon_text *txt,
+					     unsigned int posx,
+					     const struct kmscon_text_cell *cells,
+					     const struct tsm_screen_attr *attrs,
+					     size_t num, size_t i,
+					     unsigned int *width)
+{
+	bool blank = kmscon_text_is_blank(&cells[i]);
+	size_t j;
+
+	*width = cells[i].width;
+	for (j = i + 1; j < num; ++j) {
+		if (kmscon_text_is_blank(&cells[j]) != blank ||
+		    !kmscon_text_same_style(&attrs[i], &attrs[j]))
+			break;
+		if (j + cells[j].width > i + *width)
+			*width = j + cells[j].width - i;
+	}
+
+	if (posx + i + *width > txt->cols)
+		*width = txt->cols - posx - i;
+
+	return j;
+}
+
+/* libtsm only knows about single underlines */
+static inline unsigned int kmscon_text_get_decorations(
+				const struct tsm_screen_attr *attr)
+{
+	return attr->underline ? KMSCON_TEXT_UNDERLINE : 0;
+}
+
+/* Stores the lines of @decorations in @spans, which must have room for
+ * KMSCON_TEXT_MAX_SPANS entries, and returns their number. They are drawn in
+ * the foreground color of the cell. */
+static inline unsigned int kmscon_text_get_spans(const struct kmscon_text *txt,
+						 unsigned int decorations,
+						 struct kmscon_text_span *spans)
+{
+	unsigned int num = 0;
+
+	if (decorations & (KMSCON_TEXT_UNDERLINE |
+			   KMSCON_TEXT_DOUBLE_UNDERLINE))
+		spans[num++] = txt->deco[0];
+	if (decorations & KMSCON_TEXT_DOUBLE_UNDERLINE)
+		spans[num++] = txt->deco[1];
+	if (decorations & KMSCON_TEXT_STRIKETHROUGH)
+		spans[num++] = txt->deco[2];
+
+	return num;
+}
+
 int kmscon_text_draw_cb(struct tsm_screen *con,
 			uint64_t id, const uint32_t *ch, size_t len,
 			unsigned int width,
@@ -130,6 +289,7 @@ int kmscon_text_draw_cb(struct tsm_screen *con,
 extern struct kmscon_text_ops kmscon_text_bblit_ops;
 extern struct kmscon_text_ops kmscon_text_bbulk_ops;
 extern struct kmscon_text_ops kmscon_text_gltex_ops;
+extern struct kmscon_text_ops kmscon_text_gltex_grid_ops;
 extern struct kmscon_text_ops kmscon_text_pixman_ops;
 
 #endif /* KMSCON_TEXT_H */
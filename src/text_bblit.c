@@ -57,6 +57,7 @@ static int bblit_set(struct kmscon_text *txt)
 
 	txt->cols = sw / fw;
 	txt->rows = sh / fh;
+	txt->damage = true;
 
 	return 0;
 }
@@ -68,6 +69,9 @@ static int bblit_draw(struct kmscon_text *txt,
 		      const struct tsm_screen_attr *attr)
 {
 	const struct kmscon_glyph *glyph;
+	struct kmscon_glyph_req greq;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	unsigned int i, num;
 	int ret;
 	struct kmscon_font *font;
 
@@ -79,24 +83,20 @@ static int bblit_draw(struct kmscon_text *txt,
 	else
 		font = txt->font;
 
-	if (attr->underline)
-		font->attr.underline = true;
-	else
-		font->attr.underline = false;
-
-	if (attr->italic)
-		font->attr.italic = true;
-	else
-		font->attr.italic = false;
+	kmscon_text_glyph_req(&greq, id, ch, len, attr);
 
 	if (!len) {
-		ret = kmscon_font_render_empty(font, &glyph);
+		ret = kmscon_font_render_empty(font, greq.style, &glyph);
 	} else {
-		ret = kmscon_font_render(font, id, ch, len, &glyph);
+		ret = kmscon_font_render(font, &greq, &glyph);
 	}
 
+	/* placeholder until the font has rendered it, we redraw then */
+	if (ret == -EAGAIN)
+		ret = 0;
+
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph);
+		ret = kmscon_font_render_inval(font, greq.style, &glyph);
 		if (ret)
 			return ret;
 	}
@@ -115,8 +115,133 @@ static int bblit_draw(struct kmscon_text *txt,
 					       attr->fr, attr->fg, attr->fb,
 					       attr->br, attr->bg, attr->bb);
 	}
+	if (ret)
+		return ret;
 
-	return ret;
+	/* decorations are drawn over the glyph in its foreground color */
+	num = kmscon_text_get_spans(txt, kmscon_text_get_decorations(attr),
+				    spans);
+	for (i = 0; i < num; ++i) {
+		if (attr->inverse)
+			ret = uterm_display_fill(txt->disp,
+						 attr->br, attr->bg, attr->bb,
+						 posx * txt->font->attr.width,
+						 posy * txt->font->attr.height +
+						 spans[i].y,
+						 width * txt->font->attr.width,
+						 spans[i].height);
+		else
+			ret = uterm_display_fill(txt->disp,
+						 attr->fr, attr->fg, attr->fb,
+						 posx * txt->font->attr.width,
+						 posy * txt->font->attr.height +
+						 spans[i].y,
+						 width * txt->font->attr.width,
+						 spans[i].height);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+/* Like bblit_draw() but decodes the attributes once per segment of equal
+ * cells and clears blank segments with a single fill. */
+static int bblit_draw_run(struct kmscon_text *txt,
+			  unsigned int posx, unsigned int posy,
+			  const struct kmscon_text_cell *cells,
+			  const struct tsm_screen_attr *attrs,
+			  size_t num)
+{
+	const struct tsm_screen_attr *attr = NULL;
+	const struct kmscon_text_cell *cell;
+	const struct kmscon_glyph *glyph;
+	struct kmscon_glyph_req greq;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	struct kmscon_font *font = NULL;
+	unsigned int k, num_spans = 0, x, y, width;
+	size_t i, j;
+	uint8_t fc[3], bc[3];
+	int ret;
+
+	y = posy * txt->font->attr.height;
+
+	for (i = 0; i < num; i = j) {
+		if (!attr || !kmscon_text_same_style(attr, &attrs[i])) {
+			attr = &attrs[i];
+			font = attr->bold ? txt->bold_font : txt->font;
+			if (attr->inverse) {
+				fc[0] = attr->br;
+				fc[1] = attr->bg;
+				fc[2] = attr->bb;
+				bc[0] = attr->fr;
+				bc[1] = attr->fg;
+				bc[2] = attr->fb;
+			} else {
+				fc[0] = attr->fr;
+				fc[1] = attr->fg;
+				fc[2] = attr->fb;
+				bc[0] = attr->br;
+				bc[1] = attr->bg;
+				bc[2] = attr->bb;
+			}
+			num_spans = kmscon_text_get_spans(txt,
+					kmscon_text_get_decorations(attr),
+					spans);
+		}
+
+		j = kmscon_text_get_segment(txt, posx, cells, attrs, num, i,
+					    &width);
+		if (!width)
+			continue;
+
+		x = (posx + i) * txt->font->attr.width;
+
+		if (kmscon_text_is_blank(&cells[i])) {
+			ret = uterm_display_fill(txt->disp, bc[0], bc[1], bc[2],
+						 x, y,
+						 width * txt->font->attr.width,
+						 txt->font->attr.height);
+			if (ret)
+				return ret;
+		} else {
+			for (k = i; k < j; ++k) {
+				cell = &cells[k];
+				if (!cell->width)
+					continue;
+
+				kmscon_text_glyph_req(&greq, cell->id, cell->ch,
+						      cell->len, attr);
+				ret = kmscon_font_render(font, &greq, &glyph);
+				/* placeholder until rendered, we redraw then */
+				if (ret && ret != -EAGAIN) {
+					ret = kmscon_font_render_inval(font,
+							greq.style, &glyph);
+					if (ret)
+						return ret;
+				}
+
+				ret = uterm_display_fake_blend(txt->disp,
+						&glyph->buf,
+						(posx + k) * txt->font->attr.width,
+						y, fc[0], fc[1], fc[2],
+						bc[0], bc[1], bc[2]);
+				if (ret)
+					return ret;
+			}
+		}
+
+		for (k = 0; k < num_spans; ++k) {
+			ret = uterm_display_fill(txt->disp, fc[0], fc[1], fc[2],
+						 x, y + spans[k].y,
+						 width * txt->font->attr.width,
+						 spans[k].height);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return 0;
 }
 
 struct kmscon_text_ops kmscon_text_bblit_ops = {
@@ -128,6 +253,7 @@ struct kmscon_text_ops kmscon_text_bblit_ops = {
 	.unset = NULL,
 	.prepare = NULL,
 	.draw = bblit_draw,
+	.draw_run = bblit_draw_run,
 	.render = NULL,
 	.abort = NULL,
 };
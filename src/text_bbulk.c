@@ -42,10 +42,29 @@
 
 #define LOG_SUBSYSTEM "text_bbulk"
 
+struct bbulk_fill {
+	unsigned int x;
+	unsigned int y;
+	unsigned int width;
+	unsigned int height;
+	uint8_t r, g, b;
+};
+
 struct bbulk {
 	struct uterm_video_blend_req *reqs;
+	unsigned int num;
+	/* distinguishes the glyphs of this font from older ones */
+	uint64_t gen;
+
+	/* decoration lines, filled after all glyphs are blended */
+	struct bbulk_fill *fills;
+	unsigned int fill_num;
+	unsigned int fill_size;
 };
 
+/* bumped for each font so the display never reuses tiles of another font */
+static unsigned int bbulk_gen;
+
 #define FONT_WIDTH(txt) ((txt)->font->attr.width)
 #define FONT_HEIGHT(txt) ((txt)->font->attr.height)
 
@@ -71,11 +90,11 @@ static void bbulk_destroy(struct kmscon_text *txt)
 static int bbulk_set(struct kmscon_text *txt)
 {
 	struct bbulk *bb = txt->data;
-	unsigned int sw, sh, i, j;
-	struct uterm_video_blend_req *req;
+	unsigned int sw, sh;
 	struct uterm_mode *mode;
 
 	memset(bb, 0, sizeof(*bb));
+	bb->gen = (uint64_t)(++bbulk_gen & 0xffff) << 48;
 
 	mode = uterm_display_get_current(txt->disp);
 	if (!mode)
@@ -91,13 +110,8 @@ static int bbulk_set(struct kmscon_text *txt)
 		return -ENOMEM;
 	memset(bb->reqs, 0, sizeof(*bb->reqs) * txt->cols * txt->rows);
 
-	for (i = 0; i < txt->rows; ++i) {
-		for (j = 0; j < txt->cols; ++j) {
-			req = &bb->reqs[i * txt->cols + j];
-			req->x = j * FONT_WIDTH(txt);
-			req->y = i * FONT_HEIGHT(txt);
-		}
-	}
+	/* only cells that changed are queued, see bbulk_draw() */
+	txt->damage = true;
 
 	return 0;
 }
@@ -108,6 +122,66 @@ static void bbulk_unset(struct kmscon_text *txt)
 
 	free(bb->reqs);
 	bb->reqs = NULL;
+	bb->num = 0;
+	free(bb->fills);
+	bb->fills = NULL;
+	bb->fill_num = 0;
+	bb->fill_size = 0;
+}
+
+static int bbulk_prepare(struct kmscon_text *txt)
+{
+	struct bbulk *bb = txt->data;
+
+	bb->num = 0;
+	bb->fill_num = 0;
+	return 0;
+}
+
+/* Adds a decoration line. Lines that continue one of the lines of the
+ * previous cell are merged, so a decorated run costs a single fill. */
+static int add_fill(struct bbulk *bb, unsigned int x, unsigned int y,
+		    unsigned int width, unsigned int height,
+		    uint8_t r, uint8_t g, uint8_t b)
+{
+	struct bbulk_fill *fill;
+	unsigned int i, size;
+
+	for (i = 0; i < bb->fill_num && i < KMSCON_TEXT_MAX_SPANS; ++i) {
+		fill = &bb->fills[bb->fill_num - 1 - i];
+		if (fill->y == y && fill->height == height &&
+		    fill->x + fill->width == x &&
+		    fill->r == r && fill->g == g && fill->b == b) {
+			fill->width += width;
+			return 0;
+		}
+	}
+
+	if (bb->fill_num >= bb->fill_size) {
+		size = bb->fill_size ? bb->fill_size * 2 : 64;
+		fill = realloc(bb->fills, sizeof(*fill) * size);
+		if (!fill)
+			return -ENOMEM;
+		bb->fills = fill;
+		bb->fill_size = size;
+	}
+
+	fill = &bb->fills[bb->fill_num++];
+	fill->x = x;
+	fill->y = y;
+	fill->width = width;
+	fill->height = height;
+	fill->r = r;
+	fill->g = g;
+	fill->b = b;
+	return 0;
+}
+
+/* ID of the blended tile of a glyph; placeholders must not be cached */
+static uint64_t tile_id(struct bbulk *bb, const struct kmscon_glyph_req *greq,
+			bool bold)
+{
+	return KMSCON_GLYPH_KEY(greq) | ((uint64_t)bold << 47) | bb->gen;
 }
 
 static int bbulk_draw(struct kmscon_text *txt,
@@ -118,44 +192,50 @@ static int bbulk_draw(struct kmscon_text *txt,
 {
 	struct bbulk *bb = txt->data;
 	const struct kmscon_glyph *glyph;
+	struct kmscon_glyph_req greq;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	unsigned int i, num;
 	int ret;
 	struct uterm_video_blend_req *req;
 	struct kmscon_font *font;
 
-	if (!width) {
-		bb->reqs[posy * txt->cols + posx].buf = NULL;
+	if (!width)
 		return 0;
-	}
+	if (bb->num >= txt->cols * txt->rows)
+		return -ERANGE;
 
 	if (attr->bold)
 		font = txt->bold_font;
 	else
 		font = txt->font;
 
-	if (attr->underline)
-		font->attr.underline = true;
-	else
-		font->attr.underline = false;
-
-	if (attr->italic)
-		font->attr.italic = true;
-	else
-		font->attr.italic = false;
+	kmscon_text_glyph_req(&greq, id, ch, len, attr);
 
 	if (!len) {
-		ret = kmscon_font_render_empty(font, &glyph);
+		ret = kmscon_font_render_empty(font, greq.style, &glyph);
 	} else {
-		ret = kmscon_font_render(font, id, ch, len, &glyph);
+		ret = kmscon_font_render(font, &greq, &glyph);
 	}
 
+	req = &bb->reqs[bb->num];
+	req->id = 0;
+	if (len && !ret)
+		req->id = tile_id(bb, &greq, attr->bold);
+
+	/* placeholder until the font has rendered it, we redraw then */
+	if (ret == -EAGAIN)
+		ret = 0;
+
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph);
+		ret = kmscon_font_render_inval(font, greq.style, &glyph);
 		if (ret)
 			return ret;
 	}
 
-	req = &bb->reqs[posy * txt->cols + posx];
+	++bb->num;
 	req->buf = &glyph->buf;
+	req->x = posx * FONT_WIDTH(txt);
+	req->y = posy * FONT_HEIGHT(txt);
 	if (attr->inverse) {
 		req->fr = attr->br;
 		req->fg = attr->bg;
@@ -172,15 +252,151 @@ static int bbulk_draw(struct kmscon_text *txt,
 		req->bb = attr->bb;
 	}
 
+	num = kmscon_text_get_spans(txt, kmscon_text_get_decorations(attr),
+				    spans);
+	for (i = 0; i < num; ++i) {
+		ret = add_fill(bb, req->x, req->y + spans[i].y,
+			       width * FONT_WIDTH(txt), spans[i].height,
+			       req->fr, req->fg, req->fb);
+		if (ret)
+			return ret;
+	}
+
 	return 0;
 }
 
+/* Colors and decorations are decoded once per sequence of cells with equal
+ * attributes. Blank cells are not blended but cleared with a single fill. */
+static int bbulk_draw_run(struct kmscon_text *txt,
+			  unsigned int posx, unsigned int posy,
+			  const struct kmscon_text_cell *cells,
+			  const struct tsm_screen_attr *attrs,
+			  size_t num)
+{
+	struct bbulk *bb = txt->data;
+	const struct tsm_screen_attr *attr = NULL;
+	const struct kmscon_text_cell *cell;
+	const struct kmscon_glyph *glyph;
+	struct kmscon_glyph_req greq;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	struct uterm_video_blend_req *req;
+	struct kmscon_font *font = NULL;
+	unsigned int k, num_spans = 0, x, y, width;
+	size_t i, j;
+	uint8_t fc[3], bc[3];
+	int ret, err = 0;
+
+	y = posy * FONT_HEIGHT(txt);
+
+	for (i = 0; i < num; i = j) {
+		if (!attr || !kmscon_text_same_style(attr, &attrs[i])) {
+			attr = &attrs[i];
+			font = attr->bold ? txt->bold_font : txt->font;
+			if (attr->inverse) {
+				fc[0] = attr->br;
+				fc[1] = attr->bg;
+				fc[2] = attr->bb;
+				bc[0] = attr->fr;
+				bc[1] = attr->fg;
+				bc[2] = attr->fb;
+			} else {
+				fc[0] = attr->fr;
+				fc[1] = attr->fg;
+				fc[2] = attr->fb;
+				bc[0] = attr->br;
+				bc[1] = attr->bg;
+				bc[2] = attr->bb;
+			}
+			num_spans = kmscon_text_get_spans(txt,
+					kmscon_text_get_decorations(attr),
+					spans);
+		}
+
+		j = kmscon_text_get_segment(txt, posx, cells, attrs, num, i,
+					    &width);
+		if (!width)
+			continue;
+
+		x = (posx + i) * FONT_WIDTH(txt);
+
+		if (kmscon_text_is_blank(&cells[i])) {
+			ret = add_fill(bb, x, y, width * FONT_WIDTH(txt),
+				       FONT_HEIGHT(txt), bc[0], bc[1], bc[2]);
+			if (ret)
+				return ret;
+		} else {
+			for (k = i; k < j; ++k) {
+				cell = &cells[k];
+				if (!cell->width)
+					continue;
+				if (bb->num >= txt->cols * txt->rows)
+					return -ERANGE;
+
+				kmscon_text_glyph_req(&greq, cell->id, cell->ch,
+						      cell->len, attr);
+				ret = kmscon_font_render(font, &greq, &glyph);
+				/* placeholder until rendered, we redraw then */
+				if (ret && ret != -EAGAIN) {
+					ret = kmscon_font_render_inval(font,
+							greq.style, &glyph);
+					if (ret) {
+						err = ret;
+						continue;
+					}
+					ret = -EAGAIN;
+				}
+
+				req = &bb->reqs[bb->num++];
+				req->buf = &glyph->buf;
+				req->id = ret ? 0 : tile_id(bb, &greq,
+							    attr->bold);
+				req->x = (posx + k) * FONT_WIDTH(txt);
+				req->y = y;
+				req->fr = fc[0];
+				req->fg = fc[1];
+				req->fb = fc[2];
+				req->br = bc[0];
+				req->bg = bc[1];
+				req->bb = bc[2];
+			}
+		}
+
+		for (k = 0; k < num_spans; ++k) {
+			ret = add_fill(bb, x, y + spans[k].y,
+				       width * FONT_WIDTH(txt), spans[k].height,
+				       fc[0], fc[1], fc[2]);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return err;
+}
+
 static int bbulk_render(struct kmscon_text *txt)
 {
 	struct bbulk *bb = txt->data;
+	struct bbulk_fill *fill;
+	unsigned int i;
+	int ret;
+
+	/* blank cells are queued as fills only, so a frame may have no glyphs */
+	if (bb->num) {
+		ret = uterm_display_fake_blendv(txt->disp, bb->reqs, bb->num);
+		if (ret)
+			return ret;
+	}
+
+	for (i = 0; i < bb->fill_num; ++i) {
+		fill = &bb->fills[i];
+		ret = uterm_display_fill(txt->disp, fill->r, fill->g, fill->b,
+					 fill->x, fill->y, fill->width,
+					 fill->height);
+		if (ret)
+			return ret;
+	}
 
-	return uterm_display_fake_blendv(txt->disp, bb->reqs,
-					 txt->cols * txt->rows);
+	return 0;
 }
 
 struct kmscon_text_ops kmscon_text_bbulk_ops = {
@@ -190,8 +406,9 @@ struct kmscon_text_ops kmscon_text_bbulk_ops = {
 	.destroy = bbulk_destroy,
 	.set = bbulk_set,
 	.unset = bbulk_unset,
-	.prepare = NULL,
+	.prepare = bbulk_prepare,
 	.draw = bbulk_draw,
+	.draw_run = bbulk_draw_run,
 	.render = bbulk_render,
 	.abort = NULL,
 };
@@ -34,6 +34,29 @@
  * texture sizes so we need to use multiple atlases. As there is no way to pass
  * a varying amount of textures to a shader, we need to render the screen for
  * each atlas we have.
+ * Atlases are square textures with shelves of one glyph height. Glyphs are one
+ * or more cells wide and are placed into the shelves left to right. Every new
+ * atlas is twice as big as the previous one, up to the GL_MAX_TEXTURE_SIZE.
+ * Once the atlas budget of the text renderer is reached, the least recently
+ * used glyphs are evicted to make room. Glyphs of the current frame are never
+ * evicted; if there are no others, the budget is exceeded.
+ *
+ * Each atlas owns a vertex buffer with one quad-slot per cell of the grid.
+ * Slots of cells whose glyph lives in another atlas are degenerate. The CPU
+ * keeps a shadow copy of every buffer and the state of each cell, so drawing
+ * a cell only touches memory if its glyph or colors changed. Changed rows are
+ * uploaded with glBufferSubData() right before rendering and the buffers are
+ * only rebuilt if the grid-layout or orientation changes.
+ *
+ * The "gltex-grid" backend is an alternative mode for huge grids. It stores
+ * the glyph-position and colors of each cell in three small textures and
+ * draws the whole screen with a single quad; the fragment shader looks up the
+ * cell, its glyph and its colors. All glyphs live in a single atlas which
+ * is, if the budget allows, big enough for two screens of distinct glyphs.
+ *
+ * Decorations like underlines are not part of the glyphs. They are collected
+ * while drawing, merged into runs and drawn as solid quads on top of the
+ * glyphs in both modes.
  */
 
 #define GL_GLEXT_PROTOTYPES
@@ -44,6 +67,7 @@
 #include <limits.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include "shl_dlist.h"
@@ -55,15 +79,19 @@
 #include "uterm_video.h"
 #include "text_gltex_atlas.frag.bin.h"
 #include "text_gltex_atlas.vert.bin.h"
+#include "text_gltex_grid.frag.bin.h"
+#include "text_gltex_grid.vert.bin.h"
 #include "mouse_pointer.frag.bin.h"
 #include "mouse_pointer.vert.bin.h"
 
 #define LOG_SUBSYSTEM "text_gltex"
 
-/* thanks khronos for breaking backwards compatibility.. */
-#if !defined(GL_UNPACK_ROW_LENGTH) && defined(GL_UNPACK_ROW_LENGTH_EXT)
-#  define GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH_EXT
-#endif
+struct vertex {
+	GLfloat pos[2];
+	GLfloat texpos[2];
+	GLubyte fgcol[4];
+	GLubyte bgcol[4];
+};
 
 struct atlas {
 	struct shl_dlist list;
@@ -73,22 +101,52 @@ struct atlas {
 	unsigned int width;
 	unsigned int count;
 	unsigned int fill;
-
-	unsigned int cache_size;
-	unsigned int cache_num;
-	GLfloat *cache_pos;
-	GLfloat *cache_texpos;
-	GLfloat *cache_fgcol;
-	GLfloat *cache_bgcol;
+	unsigned int per_row;
+	/* slots below @fill that hold no glyph and a map of all slots */
+	unsigned int free;
+	uint8_t *slots;
+
+	/* one quad per cell, see the section comment */
+	GLuint vbo;
+	struct vertex *vertices;
+	bool *dirty_rows;
+	bool dirty;
+	unsigned int used;
 
 	GLfloat advance_htex;
 	GLfloat advance_vtex;
 };
 
+/* what is currently stored in the slot of a cell */
+struct cell {
+	struct atlas *atlas;
+	unsigned int texoff;
+	uint8_t fgcol[3];
+	uint8_t bgcol[3];
+	unsigned long frame;
+};
+
+/* a decoration line in pixels */
+struct deco {
+	unsigned int x;
+	unsigned int y;
+	unsigned int width;
+	unsigned int height;
+	uint8_t col[3];
+};
+
 struct glyph {
+	/* only valid until the glyph is uploaded, fonts may drop it afterwards */
 	const struct kmscon_glyph *glyph;
+	unsigned int width;
 	struct atlas *atlas;
 	unsigned int texoff;
+
+	/* used to evict the glyph from its table */
+	struct shl_dlist lru;
+	struct shl_hashtable *table;
+	uint64_t id;
+	unsigned long frame;
 };
 
 #define GLYPH_WIDTH(gly) ((gly)->glyph->buf.width)
@@ -113,19 +171,54 @@ struct gltex {
 	struct shl_hashtable *glyphs;
 	struct shl_hashtable *bold_glyphs;
 	unsigned int max_tex_size;
-	bool supports_rowlen;
 
 	struct shl_dlist atlases;
+	/* all glyphs, most recently used first */
+	struct shl_dlist lru;
+	unsigned long evictions;
+	bool over_budget;
+
+	/* glyphs rasterized this frame but not uploaded yet, in allocation
+	 * order; see flush_glyphs() */
+	struct glyph **pending;
+	size_t pending_num;
+	size_t pending_size;
+	uint8_t *staging;
+	size_t staging_size;
+
+	/* decoration lines of the current frame */
+	struct deco *decos;
+	size_t deco_num;
+	size_t deco_size;
 
 	GLfloat advance_x;
 	GLfloat advance_y;
 
+	/* layout the vertex buffers were built for */
+	unsigned int cols;
+	unsigned int rows;
+	GLfloat layout_x;
+	GLfloat layout_y;
+	struct cell *cells;
+	unsigned long frame;
+
+	/* cell textures of the grid mode: glyph-position, fg and bg color */
+	bool grid;
+	GLuint grid_tex[3];
+	uint8_t *grid_data[3];
+	bool *grid_dirty_rows;
+	bool grid_dirty;
+
 	struct gl_shader *shader;
 	GLuint uni_orientation;
 	GLuint uni_proj;
 	GLuint uni_atlas;
 	GLuint uni_advance_htex;
 	GLuint uni_advance_vtex;
+	GLuint uni_cells;
+	GLuint uni_fgcolors;
+	GLuint uni_bgcolors;
+	GLuint uni_grid_size;
 
 	unsigned int sw;
 	unsigned int sh;
@@ -161,13 +254,35 @@ static void gltex_destroy(struct kmscon_text *txt)
 	free(gt);
 }
 
+static void atlas_release(struct atlas *atlas, unsigned int off,
+			  unsigned int num)
+{
+	memset(&atlas->slots[off], 0, num);
+	atlas->free += num;
+}
+
 static void free_glyph(void *data)
 {
 	struct glyph *glyph = data;
 
+	shl_dlist_unlink(&glyph->lru);
+	atlas_release(glyph->atlas, glyph->texoff, glyph->width);
 	free(glyph);
 }
 
+static void free_atlas(struct atlas *atlas, bool gl)
+{
+	free(atlas->vertices);
+	free(atlas->dirty_rows);
+	free(atlas->slots);
+
+	if (gl) {
+		glDeleteBuffers(1, &atlas->vbo);
+		gl_tex_free(&atlas->tex, 1);
+	}
+	free(atlas);
+}
+
 static int gltex_set(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
@@ -175,13 +290,15 @@ static int gltex_set(struct kmscon_text *txt)
 	const char *vert, *frag;
 	static char *attr[] = { "position", "texture_position",
 				"fgcolor", "bgcolor" };
+	static char *grid_attr[] = { "position", "cell_position" };
 	GLint s;
-	const char *ext;
 	struct uterm_mode *mode;
 	bool opengl;
 
 	memset(gt, 0, sizeof(*gt));
 	shl_dlist_init(&gt->atlases);
+	shl_dlist_init(&gt->lru);
+	gt->grid = txt->ops == &kmscon_text_gltex_grid_ops;
 
 	ret = shl_hashtable_new(&gt->glyphs, shl_direct_hash,
 				shl_direct_equal, free_glyph);
@@ -200,14 +317,25 @@ static int gltex_set(struct kmscon_text *txt)
 		goto err_bold_htable;
 	}
 
-	vert = _binary_text_gltex_atlas_vert_start;
-	vlen = _binary_text_gltex_atlas_vert_size;
-	frag = _binary_text_gltex_atlas_frag_start;
-	flen = _binary_text_gltex_atlas_frag_size;
-	gl_clear_error();
+	if (gt->grid) {
+		vert = _binary_text_gltex_grid_vert_start;
+		vlen = _binary_text_gltex_grid_vert_size;
+		frag = _binary_text_gltex_grid_frag_start;
+		flen = _binary_text_gltex_grid_frag_size;
+		gl_clear_error();
 
-	ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen, attr, 4,
-			    log_llog, NULL);
+		ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen,
+				    grid_attr, 2, log_llog, NULL);
+	} else {
+		vert = _binary_text_gltex_atlas_vert_start;
+		vlen = _binary_text_gltex_atlas_vert_size;
+		frag = _binary_text_gltex_atlas_frag_start;
+		flen = _binary_text_gltex_atlas_frag_size;
+		gl_clear_error();
+
+		ret = gl_shader_new(&gt->shader, vert, vlen, frag, flen,
+				    attr, 4, log_llog, NULL);
+	}
 	if (ret)
 		goto err_bold_htable;
 
@@ -218,6 +346,15 @@ static int gltex_set(struct kmscon_text *txt)
 						     "advance_htex");
 	gt->uni_advance_vtex = gl_shader_get_uniform(gt->shader,
 						     "advance_vtex");
+	if (gt->grid) {
+		gt->uni_cells = gl_shader_get_uniform(gt->shader, "cells");
+		gt->uni_fgcolors = gl_shader_get_uniform(gt->shader,
+							 "fgcolors");
+		gt->uni_bgcolors = gl_shader_get_uniform(gt->shader,
+							 "bgcolors");
+		gt->uni_grid_size = gl_shader_get_uniform(gt->shader,
+							  "grid_size");
+	}
 
 	if (gl_has_error(gt->shader)) {
 		log_warning("cannot create shader");
@@ -267,19 +404,10 @@ static int gltex_set(struct kmscon_text *txt)
 	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &s);
 	if (s <= 0)
 		s = 64;
-	else if (s > 2048)
-		s = 2048;
 	gt->max_tex_size = s;
 
 	gl_clear_error();
 
-	ext = (const char*)glGetString(GL_EXTENSIONS);
-	if (ext && strstr((const char*)ext, "GL_EXT_unpack_subimage")) {
-		gt->supports_rowlen = true;
-	} else {
-		log_warning("your GL implementation does not support GL_EXT_unpack_subimage, glyph-rendering may be slower than usual");
-	}
-
 	return 0;
 
 err_mouse_pointer_shader:
@@ -314,42 +442,401 @@ static void gltex_unset(struct kmscon_text *txt)
 		iter = gt->atlases.next;
 		shl_dlist_unlink(iter);
 		atlas = shl_dlist_entry(iter, struct atlas, list);
-
-		free(atlas->cache_pos);
-		free(atlas->cache_texpos);
-		free(atlas->cache_fgcol);
-		free(atlas->cache_bgcol);
-
-		if (gl)
-			gl_tex_free(&atlas->tex, 1);
-		free(atlas);
+		free_atlas(atlas, gl);
 	}
 
+	free(gt->pending);
+	free(gt->staging);
+	free(gt->decos);
+	free(gt->cells);
+	free(gt->grid_data[0]);
+	free(gt->grid_data[1]);
+	free(gt->grid_data[2]);
+	free(gt->grid_dirty_rows);
+
 	if (gl) {
+		if (gt->grid_tex[0])
+			gl_tex_free(gt->grid_tex, 3);
 		gl_shader_unref(gt->shader);
 
 		gl_clear_error();
 	}
 }
 
-/* returns an atlas with at least 1 free glyph position; NULL on error */
-static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
+/* (re)allocates the vertex buffer of @atlas for the current layout with all
+ * slots degenerate */
+static int atlas_layout(struct gltex *gt, struct atlas *atlas)
+{
+	size_t num = (size_t)gt->cols * gt->rows * 6;
+	struct vertex *vertices;
+	bool *rows;
+
+	vertices = calloc(num ? num : 1, sizeof(*vertices));
+	if (!vertices)
+		return -ENOMEM;
+	rows = calloc(gt->rows ? gt->rows : 1, sizeof(*rows));
+	if (!rows) {
+		free(vertices);
+		return -ENOMEM;
+	}
+
+	free(atlas->vertices);
+	free(atlas->dirty_rows);
+	atlas->vertices = vertices;
+	atlas->dirty_rows = rows;
+	atlas->dirty = false;
+	atlas->used = 0;
+
+	glBindBuffer(GL_ARRAY_BUFFER, atlas->vbo);
+	glBufferData(GL_ARRAY_BUFFER, num * sizeof(*vertices), vertices,
+		     GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	return 0;
+}
+
+/* drops all glyphs from the grid atlas and clears all cells */
+static void grid_reset(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
 	struct atlas *atlas;
-	size_t newsize;
-	unsigned int width, height, nsize;
+	size_t num = (size_t)gt->cols * gt->rows;
+	unsigned int i;
+
+	gt->pending_num = 0;
+	shl_hashtable_clear(gt->glyphs);
+	shl_hashtable_clear(gt->bold_glyphs);
+
+	if (!shl_dlist_empty(&gt->atlases)) {
+		atlas = shl_dlist_entry(gt->atlases.next, struct atlas, list);
+		atlas->fill = 0;
+		atlas->free = 0;
+	}
+
+	memset(gt->cells, 0, sizeof(*gt->cells) * num);
+	for (i = 0; i < 3; ++i)
+		memset(gt->grid_data[i], 0, num * 4);
+	for (i = 0; i < gt->rows; ++i)
+		gt->grid_dirty_rows[i] = true;
+	gt->grid_dirty = true;
+}
+
+/* (re)allocates the cell textures for the current layout; the atlas is
+ * dropped if it cannot hold a frame of the new grid */
+static int grid_layout(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	size_t num = (size_t)gt->cols * gt->rows;
+	uint8_t *data[3];
+	bool *rows;
+	unsigned int i;
 	GLenum err;
 
-	/* check whether the last added atlas has still room for one glyph */
+	rows = calloc(gt->rows ? gt->rows : 1, sizeof(*rows));
+	if (!rows)
+		return -ENOMEM;
+
+	for (i = 0; i < 3; ++i) {
+		data[i] = calloc(num ? num : 1, 4);
+		if (!data[i]) {
+			while (i--)
+				free(data[i]);
+			free(rows);
+			return -ENOMEM;
+		}
+	}
+
+	for (i = 0; i < 3; ++i) {
+		free(gt->grid_data[i]);
+		gt->grid_data[i] = data[i];
+	}
+	free(gt->grid_dirty_rows);
+	gt->grid_dirty_rows = rows;
+	gt->grid_dirty = false;
+
 	if (!shl_dlist_empty(&gt->atlases)) {
-		atlas = shl_dlist_entry(gt->atlases.next, struct atlas,
-					   list);
-		if (atlas->fill + num <= atlas->count)
-			return atlas;
+		atlas = shl_dlist_entry(gt->atlases.next, struct atlas, list);
+		if (atlas->count < num + atlas->height / FONT_HEIGHT(txt)) {
+			grid_reset(txt);
+			shl_dlist_unlink(&atlas->list);
+			free_atlas(atlas, true);
+		}
+	}
+
+	gl_clear_error();
+
+	if (!gt->grid_tex[0])
+		gl_tex_new(gt->grid_tex, 3);
+
+	for (i = 0; i < 3; ++i) {
+		glBindTexture(GL_TEXTURE_2D, gt->grid_tex[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+				GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+				GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, gt->cols, gt->rows, 0,
+			     GL_RGBA, GL_UNSIGNED_BYTE, gt->grid_data[i]);
+	}
+
+	err = glGetError();
+	if (err != GL_NO_ERROR) {
+		gl_clear_error();
+		log_warning("cannot allocate %ux%u cell textures (%d: %s)",
+			    gt->cols, gt->rows, err, gl_err_to_str(err));
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+/* rebuilds all buffers if the grid or its geometry changed */
+static int update_layout(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+	struct cell *cells;
+	size_t num = (size_t)txt->cols * txt->rows;
+	int ret;
+
+	if (gt->cells && gt->cols == txt->cols && gt->rows == txt->rows &&
+	    gt->layout_x == gt->advance_x && gt->layout_y == gt->advance_y)
+		return 0;
+
+	cells = calloc(num ? num : 1, sizeof(*cells));
+	if (!cells)
+		return -ENOMEM;
+
+	free(gt->cells);
+	gt->cells = cells;
+	gt->cols = txt->cols;
+	gt->rows = txt->rows;
+	gt->layout_x = gt->advance_x;
+	gt->layout_y = gt->advance_y;
+
+	if (gt->grid) {
+		ret = grid_layout(txt);
+		if (ret)
+			goto err_layout;
+		return 0;
+	}
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		ret = atlas_layout(gt, atlas);
+		if (ret)
+			goto err_layout;
+	}
+
+	return 0;
+
+err_layout:
+	/* an empty grid makes us retry on the next frame */
+	free(gt->cells);
+	gt->cells = NULL;
+	gt->cols = 0;
+	gt->rows = 0;
+	return ret;
+}
+
+static void slot_set_pos(struct gltex *gt, struct vertex *v,
+			 unsigned int posx, unsigned int posy)
+{
+	GLfloat x0, y0, x1, y1;
+
+	x0 = gt->advance_x * posx - 1;
+	x1 = gt->advance_x * posx + gt->advance_x - 1;
+	y0 = 1 - gt->advance_y * posy;
+	y1 = 1 - (gt->advance_y * posy + gt->advance_y);
+
+	v[0].pos[0] = x0;
+	v[0].pos[1] = y0;
+	v[1].pos[0] = x0;
+	v[1].pos[1] = y1;
+	v[2].pos[0] = x1;
+	v[2].pos[1] = y1;
+
+	v[3].pos[0] = x0;
+	v[3].pos[1] = y0;
+	v[4].pos[0] = x1;
+	v[4].pos[1] = y1;
+	v[5].pos[0] = x1;
+	v[5].pos[1] = y0;
+}
+
+static void slot_clear(struct gltex *gt, struct atlas *atlas,
+		       unsigned int posx, unsigned int posy)
+{
+	struct vertex *v = &atlas->vertices[(posy * gt->cols + posx) * 6];
+
+	memset(v, 0, sizeof(*v) * 6);
+	atlas->dirty_rows[posy] = true;
+	atlas->dirty = true;
+	--atlas->used;
+}
+
+static void cell_set(struct gltex *gt, struct atlas *atlas,
+		     unsigned int posx, unsigned int posy, unsigned int texoff,
+		     const uint8_t *fgcol, const uint8_t *bgcol)
+{
+	struct cell *cell = &gt->cells[posy * gt->cols + posx];
+	struct vertex *v;
+	GLfloat x, y;
+	unsigned int i;
+
+	cell->frame = gt->frame;
+	if (cell->atlas == atlas && cell->texoff == texoff &&
+	    !memcmp(cell->fgcol, fgcol, 3) && !memcmp(cell->bgcol, bgcol, 3))
+		return;
+
+	v = &atlas->vertices[(posy * gt->cols + posx) * 6];
+	if (cell->atlas != atlas) {
+		if (cell->atlas)
+			slot_clear(gt, cell->atlas, posx, posy);
+		slot_set_pos(gt, v, posx, posy);
+		cell->atlas = atlas;
+		++atlas->used;
+	}
+
+	x = texoff % atlas->per_row;
+	y = texoff / atlas->per_row;
+
+	v[0].texpos[0] = x;
+	v[0].texpos[1] = y;
+	v[1].texpos[0] = x;
+	v[1].texpos[1] = y + 1;
+	v[2].texpos[0] = x + 1;
+	v[2].texpos[1] = y + 1;
+
+	v[3].texpos[0] = x;
+	v[3].texpos[1] = y;
+	v[4].texpos[0] = x + 1;
+	v[4].texpos[1] = y + 1;
+	v[5].texpos[0] = x + 1;
+	v[5].texpos[1] = y;
+
+	for (i = 0; i < 6; ++i) {
+		memcpy(v[i].fgcol, fgcol, 3);
+		memcpy(v[i].bgcol, bgcol, 3);
+	}
+
+	cell->texoff = texoff;
+	memcpy(cell->fgcol, fgcol, 3);
+	memcpy(cell->bgcol, bgcol, 3);
+	atlas->dirty_rows[posy] = true;
+	atlas->dirty = true;
+}
+
+static void grid_cell_set(struct gltex *gt, struct atlas *atlas,
+			  unsigned int posx, unsigned int posy,
+			  unsigned int texoff,
+			  const uint8_t *fgcol, const uint8_t *bgcol)
+{
+	size_t idx = posy * gt->cols + posx;
+	struct cell *cell = &gt->cells[idx];
+	unsigned int x, y;
+	uint8_t *slot, *fg, *bg;
+
+	cell->frame = gt->frame;
+	if (cell->atlas == atlas && cell->texoff == texoff &&
+	    !memcmp(cell->fgcol, fgcol, 3) && !memcmp(cell->bgcol, bgcol, 3))
+		return;
+
+	x = texoff % atlas->per_row;
+	y = texoff / atlas->per_row;
+	slot = &gt->grid_data[0][idx * 4];
+	fg = &gt->grid_data[1][idx * 4];
+	bg = &gt->grid_data[2][idx * 4];
+
+	slot[0] = x & 0xff;
+	slot[1] = x >> 8;
+	slot[2] = y & 0xff;
+	slot[3] = y >> 8;
+	memcpy(fg, fgcol, 3);
+	fg[3] = 0xff;
+	memcpy(bg, bgcol, 3);
+	bg[3] = 0xff;
+
+	cell->atlas = atlas;
+	cell->texoff = texoff;
+	memcpy(cell->fgcol, fgcol, 3);
+	memcpy(cell->bgcol, bgcol, 3);
+	gt->grid_dirty_rows[posy] = true;
+	gt->grid_dirty = true;
+}
+
+static void grid_cell_clear(struct gltex *gt, unsigned int posx,
+			    unsigned int posy)
+{
+	size_t idx = posy * gt->cols + posx;
+
+	/* a foreground alpha of 0 makes the shader skip the cell */
+	gt->grid_data[1][idx * 4 + 3] = 0;
+	gt->grid_dirty_rows[posy] = true;
+	gt->grid_dirty = true;
+}
+
+/* number of glyphs of one cell-width that fit into an atlas of size @side */
+static size_t atlas_capacity(struct kmscon_text *txt, unsigned int side)
+{
+	return (size_t)(side / FONT_WIDTH(txt)) * (side / FONT_HEIGHT(txt));
+}
+
+/* allocates a new square atlas; the first one is big enough for a screen of
+ * distinct glyphs (two in grid mode) and every further one doubles in size.
+ * Atlases that would exceed the budget are shrunk or not created at all,
+ * unless @force is set. The grid atlas is never shrunk below a screen of
+ * glyphs, as it has to hold a whole frame. */
+static struct atlas *new_atlas(struct kmscon_text *txt, bool force)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas, *last;
+	size_t need, used = 0, min, cells;
+	unsigned int side;
+	GLenum err;
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		last = shl_dlist_entry(iter, struct atlas, list);
+		used += (size_t)last->width * last->height;
+	}
+
+	min = shl_next_pow2(FONT_WIDTH(txt) > FONT_HEIGHT(txt) ?
+			    FONT_WIDTH(txt) : FONT_HEIGHT(txt));
+	if (min > gt->max_tex_size) {
+		log_warning("OpenGL textures too small for a single glyph");
+		return NULL;
+	}
+
+	cells = (size_t)gt->cols * gt->rows;
+	if (shl_dlist_empty(&gt->atlases)) {
+		need = cells * (gt->grid ? 2 : 1);
+		side = min;
+		while (side < gt->max_tex_size &&
+		       atlas_capacity(txt, side) < need)
+			side *= 2;
+	} else {
+		last = shl_dlist_first(&gt->atlases, struct atlas, list);
+		side = last->width * 2;
+		if (side > gt->max_tex_size)
+			side = gt->max_tex_size;
+	}
+
+	if (txt->atlas_budget && !force) {
+		while (side > min &&
+		       used + (size_t)side * side > txt->atlas_budget) {
+			/* each shelf may end with an unusable slot */
+			if (gt->grid && atlas_capacity(txt, side / 2) <
+			    cells + side / 2 / FONT_HEIGHT(txt))
+				break;
+			side /= 2;
+		}
+		if (used + (size_t)side * side > txt->atlas_budget &&
+		    !shl_dlist_empty(&gt->atlases))
+			return NULL;
 	}
 
-	/* all atlases are full so we have to create a new atlas */
 	atlas = malloc(sizeof(*atlas));
 	if (!atlas)
 		return NULL;
@@ -365,27 +852,25 @@ static struct atlas *get_atlas(struct kmscon_text *txt, unsigned int num)
 		goto err_free;
 	}
 
-	newsize = gt->max_tex_size / FONT_WIDTH(txt);
-	if (newsize < 1)
-		newsize = 1;
+	if (gt->grid) {
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+				GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+				GL_NEAREST);
+	}
 
-	/* OpenGL texture sizes are heavily restricted so we need to find a
-	 * valid texture size that is big enough to hold as many glyphs as
-	 * possible but at least 1 */
+	/* the driver may still refuse big textures, so retry smaller ones */
 try_next:
-	width = shl_next_pow2(FONT_WIDTH(txt) * newsize);
-	height = shl_next_pow2(FONT_HEIGHT(txt));
-
 	gl_clear_error();
 
 	glBindTexture(GL_TEXTURE_2D, atlas->tex);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height,
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, side, side,
 		     0, GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
 
 	err = glGetError();
 	if (err != GL_NO_ERROR) {
-		if (newsize > 1) {
-			--newsize;
+		if (side > min) {
+			side /= 2;
 			goto try_next;
 		}
 		gl_clear_error();
@@ -394,41 +879,34 @@ try_next:
 		goto err_tex;
 	}
 
-	log_debug("new atlas of size %ux%u for %zu", width, height, newsize);
-
-	nsize = txt->cols * txt->rows;
-
-	atlas->cache_pos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_pos)
-		goto err_mem;
-
-	atlas->cache_texpos = malloc(sizeof(GLfloat) * nsize * 2 * 6);
-	if (!atlas->cache_texpos)
-		goto err_mem;
+	atlas->per_row = side / FONT_WIDTH(txt);
+	atlas->count = atlas->per_row * (side / FONT_HEIGHT(txt));
+	atlas->width = side;
+	atlas->height = side;
+	atlas->advance_htex = 1.0 / atlas->width * FONT_WIDTH(txt);
+	atlas->advance_vtex = 1.0 / atlas->height * FONT_HEIGHT(txt);
 
-	atlas->cache_fgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_fgcol)
-		goto err_mem;
+	atlas->slots = calloc(atlas->count, 1);
+	if (!atlas->slots)
+		goto err_tex;
 
-	atlas->cache_bgcol = malloc(sizeof(GLfloat) * nsize * 3 * 6);
-	if (!atlas->cache_bgcol)
-		goto err_mem;
+	if (!gt->grid) {
+		glGenBuffers(1, &atlas->vbo);
+		if (atlas_layout(gt, atlas))
+			goto err_mem;
+	}
 
-	atlas->cache_size = nsize;
-	atlas->count = newsize;
-	atlas->width = width;
-	atlas->height = height;
-	atlas->advance_htex = 1.0 / atlas->width * FONT_WIDTH(txt);
-	atlas->advance_vtex = 1.0 / atlas->height * FONT_HEIGHT(txt);
+	log_debug("new atlas of size %ux%u for %u glyphs", side, side,
+		  atlas->count);
 
 	shl_dlist_link(&gt->atlases, &atlas->list);
 	return atlas;
 
 err_mem:
-	free(atlas->cache_pos);
-	free(atlas->cache_texpos);
-	free(atlas->cache_fgcol);
-	free(atlas->cache_bgcol);
+	glDeleteBuffers(1, &atlas->vbo);
+	free(atlas->vertices);
+	free(atlas->dirty_rows);
+	free(atlas->slots);
 err_tex:
 	gl_tex_free(&atlas->tex, 1);
 err_free:
@@ -436,18 +914,158 @@ err_free:
 	return NULL;
 }
 
+/* whether @num slots at @off are free and in the same shelf */
+static bool atlas_is_free(struct atlas *atlas, unsigned int off,
+			  unsigned int num)
+{
+	unsigned int i;
+
+	if (off % atlas->per_row + num > atlas->per_row ||
+	    off + num > atlas->fill)
+		return false;
+
+	for (i = 0; i < num; ++i) {
+		if (atlas->slots[off + i])
+			return false;
+	}
+
+	return true;
+}
+
+static void atlas_take(struct atlas *atlas, unsigned int off,
+		       unsigned int num)
+{
+	memset(&atlas->slots[off], 1, num);
+	atlas->free -= num;
+}
+
+/* finds @num free slots in one shelf; freed slots are reused first, then
+ * the shelves are filled from the top */
+static bool atlas_alloc(struct atlas *atlas, unsigned int num,
+			unsigned int *out)
+{
+	unsigned int i, skip;
+
+	if (atlas->free >= num) {
+		for (i = 0; i + num <= atlas->fill; ++i) {
+			if (atlas_is_free(atlas, i, num)) {
+				atlas_take(atlas, i, num);
+				*out = i;
+				return true;
+			}
+		}
+	}
+
+	/* glyphs never wrap across shelves */
+	skip = 0;
+	if (atlas->fill % atlas->per_row + num > atlas->per_row)
+		skip = atlas->per_row - atlas->fill % atlas->per_row;
+	if (atlas->fill + skip + num > atlas->count)
+		return false;
+
+	i = atlas->fill + skip;
+	atlas->fill += skip + num;
+	atlas->free += skip + num;
+	atlas_take(atlas, i, num);
+	*out = i;
+	return true;
+}
+
+/* evicts least recently used glyphs until @num adjacent slots are free;
+ * returns false if all remaining glyphs are used by the current frame */
+static bool evict_glyphs(struct kmscon_text *txt, unsigned int num,
+			 struct atlas **out, unsigned int *off)
+{
+	struct gltex *gt = txt->data;
+	struct glyph *glyph;
+	struct atlas *atlas;
+	unsigned int pos, width, i;
+
+	while (!shl_dlist_empty(&gt->lru)) {
+		glyph = shl_dlist_last(&gt->lru, struct glyph, lru);
+		if (glyph->frame == gt->frame)
+			return false;
+
+		atlas = glyph->atlas;
+		pos = glyph->texoff;
+		width = glyph->width;
+		shl_hashtable_remove(glyph->table, glyph->id);
+		++gt->evictions;
+
+		/* only the freed slots and their neighbors can fit now */
+		i = pos >= num - 1 ? pos - (num - 1) : 0;
+		for ( ; i < pos + width; ++i) {
+			if (atlas_is_free(atlas, i, num)) {
+				atlas_take(atlas, i, num);
+				*out = atlas;
+				*off = i;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/* reserves @num adjacent glyph-slots in an atlas */
+static int alloc_glyph(struct kmscon_text *txt, unsigned int num,
+		       struct atlas **out, unsigned int *off)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (atlas_alloc(atlas, num, off)) {
+			*out = atlas;
+			return 0;
+		}
+	}
+
+	/* grid mode draws from a single atlas only */
+	if (!gt->grid || shl_dlist_empty(&gt->atlases)) {
+		atlas = new_atlas(txt, false);
+		if (atlas && atlas_alloc(atlas, num, off)) {
+			*out = atlas;
+			return 0;
+		}
+	}
+
+	if (evict_glyphs(txt, num, out, off))
+		return 0;
+
+	if (!gt->grid) {
+		if (!gt->over_budget) {
+			log_warning("glyphs of a single frame exceed the atlas budget");
+			gt->over_budget = true;
+		}
+
+		atlas = new_atlas(txt, true);
+		if (atlas && atlas_alloc(atlas, num, off)) {
+			*out = atlas;
+			return 0;
+		}
+	}
+
+	log_warning("no space left in glyph atlas");
+	return -ENOSPC;
+}
+
 static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 		      uint64_t id, const uint32_t *ch, size_t len, const struct tsm_screen_attr *attr)
 {
 	struct gltex *gt = txt->data;
 	struct atlas *atlas;
-	struct glyph *glyph;
+	struct glyph *glyph, *cached;
+	struct glyph **pending;
 	bool res;
-	int ret, i;
-	GLenum err;
-	uint8_t *packed_data, *dst, *src;
+	int ret;
+	size_t size;
+	unsigned int off;
 	struct shl_hashtable *gtable;
 	struct kmscon_font *font;
+	struct kmscon_glyph_req greq;
 
 	if (attr->bold) {
 		gtable = gt->bold_glyphs;
@@ -457,18 +1075,15 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 		font = txt->font;
 	}
 
-	if (attr->underline)
-		font->attr.underline = true;
-	else
-		font->attr.underline = false;
-
-	if (attr->italic)
-		font->attr.italic = true;
-	else
-		font->attr.italic = false;
+	/* each style is cached separately */
+	kmscon_text_glyph_req(&greq, id, ch, len, attr);
+	id = KMSCON_GLYPH_KEY(&greq);
 
 	res = shl_hashtable_find(gtable, (void**)&glyph, id);
 	if (res) {
+		glyph->frame = gt->frame;
+		shl_dlist_unlink(&glyph->lru);
+		shl_dlist_link(&gt->lru, &glyph->lru);
 		*out = glyph;
 		return 0;
 	}
@@ -479,76 +1094,161 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 	memset(glyph, 0, sizeof(*glyph));
 
 	if (!len)
-		ret = kmscon_font_render_empty(font, &glyph->glyph);
+		ret = kmscon_font_render_empty(font, greq.style, &glyph->glyph);
 	else
-		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+		ret = kmscon_font_render(font, &greq, &glyph->glyph);
+
+	/* pending placeholder, see KMSCON_FONT_PENDING_ID() */
+	if (ret == -EAGAIN) {
+		id = KMSCON_FONT_PENDING_ID(glyph->glyph->width);
+		res = shl_hashtable_find(gtable, (void**)&cached, id);
+		if (res) {
+			free(glyph);
+			cached->frame = gt->frame;
+			shl_dlist_unlink(&cached->lru);
+			shl_dlist_link(&gt->lru, &cached->lru);
+			*out = cached;
+			return 0;
+		}
+		ret = 0;
+	}
 
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		ret = kmscon_font_render_inval(font, greq.style, &glyph->glyph);
 		if (ret)
 			goto err_free;
 	}
 
-	atlas = get_atlas(txt, glyph->glyph->width);
-	if (!atlas) {
-		ret = -EFAULT;
+	glyph->width = glyph->glyph->width;
+	ret = alloc_glyph(txt, glyph->width, &atlas, &off);
+	if (ret)
 		goto err_free;
+
+	/* The texture is written in flush_glyphs() right before the next
+	 * render so all glyphs of a frame are uploaded together. */
+	if (gt->pending_num >= gt->pending_size) {
+		size = gt->pending_size ? gt->pending_size * 2 : 64;
+		pending = realloc(gt->pending, sizeof(*pending) * size);
+		if (!pending) {
+			ret = -ENOMEM;
+			goto err_release;
+		}
+		gt->pending = pending;
+		gt->pending_size = size;
 	}
 
-	/* Funnily, not all OpenGLESv2 implementations support specifying the
-	 * stride of a texture. Therefore, we then need to create a
-	 * temporary image with a stride equal to the image width for loading
-	 * the texture. This may slow down loading new glyphs but doesn't affect
-	 * overall rendering performance. But driver developers should really
-	 * add this! */
+	glyph->atlas = atlas;
+	glyph->texoff = off;
+	glyph->table = gtable;
+	glyph->id = id;
+	glyph->frame = gt->frame;
 
-	gl_clear_error();
+	ret = shl_hashtable_insert(gtable, id, glyph);
+	if (ret)
+		goto err_release;
 
-	glBindTexture(GL_TEXTURE_2D, atlas->tex);
+	shl_dlist_link(&gt->lru, &glyph->lru);
+	gt->pending[gt->pending_num++] = glyph;
+
+	*out = glyph;
+	return 0;
+
+err_release:
+	atlas_release(atlas, off, glyph->width);
+err_free:
+	free(glyph);
+	return ret;
+}
+
+/* Uploads all pending glyphs. Glyphs which were given adjacent slots on the
+ * same shelf of an atlas (which is the common case as new glyphs are handed
+ * out left to right) are packed into the staging buffer and written with a
+ * single glTexSubImage2D(). This also avoids depending on
+ * GL_EXT_unpack_subimage as the staging buffer is always tightly packed.
+ * OpenGLES2 has no pixel-buffer-objects so the data is copied by the driver
+ * either way, but a handful of large uploads is a lot cheaper than hundreds of
+ * tiny ones when a new screen full of CJK glyphs shows up. */
+static void flush_glyphs(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct glyph *glyph;
+	struct atlas *atlas;
+	size_t i, j, k, size;
+	unsigned int num, x, w, h, row, fw = FONT_WIDTH(txt),
+		     fh = FONT_HEIGHT(txt);
+	uint8_t *staging;
+	const uint8_t *src;
+	GLenum err;
+
+	if (!gt->pending_num)
+		return;
+
+	gl_clear_error();
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	if (!gt->supports_rowlen) {
-		if (GLYPH_STRIDE(glyph) == GLYPH_WIDTH(glyph)) {
-			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
-					GLYPH_WIDTH(glyph),
-					GLYPH_HEIGHT(glyph),
-					GL_ALPHA, GL_UNSIGNED_BYTE,
-					GLYPH_DATA(glyph));
-		} else {
-			packed_data = malloc(GLYPH_WIDTH(glyph) * GLYPH_HEIGHT(glyph));
-			if (!packed_data) {
-				log_error("cannot allocate memory for glyph storage");
-				ret = -ENOMEM;
-				goto err_free;
+
+	for (i = 0; i < gt->pending_num; i = j) {
+		glyph = gt->pending[i];
+		atlas = glyph->atlas;
+		num = glyph->width;
+
+		for (j = i + 1; j < gt->pending_num; ++j) {
+			glyph = gt->pending[j];
+			if (glyph->atlas != atlas ||
+			    glyph->texoff != gt->pending[i]->texoff + num ||
+			    glyph->texoff / atlas->per_row !=
+			    gt->pending[i]->texoff / atlas->per_row)
+				break;
+			num += glyph->width;
+		}
+
+		size = (size_t)num * fw * fh;
+		if (size > gt->staging_size) {
+			staging = realloc(gt->staging, size);
+			if (!staging) {
+				log_warning("cannot allocate glyph staging buffer");
+				break;
 			}
+			gt->staging = staging;
+			gt->staging_size = size;
+		}
+		memset(gt->staging, 0, size);
+
+		for (k = i, x = 0; k < j; ++k) {
+			glyph = gt->pending[k];
+			w = glyph->width * fw;
+			if (w > GLYPH_WIDTH(glyph))
+				w = GLYPH_WIDTH(glyph);
+			h = fh;
+			if (h > GLYPH_HEIGHT(glyph))
+				h = GLYPH_HEIGHT(glyph);
 
 			src = GLYPH_DATA(glyph);
-			dst = packed_data;
-			for (i = 0; i < GLYPH_HEIGHT(glyph); ++i) {
-				memcpy(dst, src, GLYPH_WIDTH(glyph));
-				dst += GLYPH_WIDTH(glyph);
+			staging = &gt->staging[x];
+			for (row = 0; row < h; ++row) {
+				if (glyph->glyph->buf.format ==
+				    UTERM_FORMAT_MONO)
+					uterm_video_unfold_mono(staging, src,
+								w);
+				else
+					memcpy(staging, src, w);
+				staging += num * fw;
 				src += GLYPH_STRIDE(glyph);
 			}
 
-			glTexSubImage2D(GL_TEXTURE_2D, 0,
-					FONT_WIDTH(txt) * atlas->fill, 0,
-					GLYPH_WIDTH(glyph),
-					GLYPH_HEIGHT(glyph),
-					GL_ALPHA, GL_UNSIGNED_BYTE,
-					packed_data);
-			free(packed_data);
+			x += glyph->width * fw;
 		}
-	} else {
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, GLYPH_STRIDE(glyph));
+
+		glyph = gt->pending[i];
+		glBindTexture(GL_TEXTURE_2D, atlas->tex);
 		glTexSubImage2D(GL_TEXTURE_2D, 0,
-				FONT_WIDTH(txt) * atlas->fill, 0,
-				GLYPH_WIDTH(glyph),
-				GLYPH_HEIGHT(glyph),
-				GL_ALPHA, GL_UNSIGNED_BYTE,
-				GLYPH_DATA(glyph));
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+				fw * (glyph->texoff % atlas->per_row),
+				fh * (glyph->texoff / atlas->per_row),
+				num * fw, fh, GL_ALPHA, GL_UNSIGNED_BYTE,
+				gt->staging);
 	}
+
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	gt->pending_num = 0;
 
 	/* Check for GL-errors
 	 * As OpenGL is a state-machine, we cannot really tell which call failed
@@ -563,25 +1263,7 @@ static int find_glyph(struct kmscon_text *txt, struct glyph **out,
 		gl_clear_error();
 		log_warning("cannot load glyph data into OpenGL texture (%d: %s); disable the GL-renderer if this does not work reliably",
 			    err, gl_err_to_str(err));
-		ret = -EFAULT;
-		goto err_free;
 	}
-
-	glyph->atlas = atlas;
-	glyph->texoff = atlas->fill;
-
-	ret = shl_hashtable_insert(gtable, id, glyph);
-	if (ret)
-		goto err_free;
-
-	atlas->fill += glyph->glyph->width;
-
-	*out = glyph;
-	return 0;
-
-err_free:
-	free(glyph);
-	return ret;
 }
 
 static int gltex_rotate(struct kmscon_text *txt, unsigned int orientation)
@@ -624,20 +1306,12 @@ static int gltex_rotate(struct kmscon_text *txt, unsigned int orientation)
 static int gltex_prepare(struct kmscon_text *txt)
 {
 	struct gltex *gt = txt->data;
-	struct atlas *atlas;
-	struct shl_dlist *iter;
 	int ret;
 
 	ret = uterm_display_use(txt->disp, NULL);
 	if (ret)
 		return ret;
 
-	shl_dlist_for_each(iter, &gt->atlases) {
-		atlas = shl_dlist_entry(iter, struct atlas, list);
-
-		atlas->cache_num = 0;
-	}
-
 	if (txt->orientation == ORIENTATION_NORMAL ) {
 		gt->angle = .0;
 	} else if (txt->orientation == ORIENTATION_INVERTED) {
@@ -657,6 +1331,50 @@ static int gltex_prepare(struct kmscon_text *txt)
 		gt->advance_y = 2.0 / gt->sh * FONT_HEIGHT(txt) * (1./aspect);
 	}
 
+	/* glyphs of a frame that was never rendered */
+	flush_glyphs(txt);
+	gt->deco_num = 0;
+
+	ret = update_layout(txt);
+	if (ret)
+		return ret;
+
+	++gt->frame;
+	return 0;
+}
+
+/* adds a decoration line, continuing one of the last lines if possible */
+static int add_deco(struct gltex *gt, unsigned int x, unsigned int y,
+		    unsigned int width, unsigned int height,
+		    const uint8_t *col)
+{
+	struct deco *deco;
+	size_t i, size;
+
+	for (i = 0; i < gt->deco_num && i < KMSCON_TEXT_MAX_SPANS; ++i) {
+		deco = &gt->decos[gt->deco_num - 1 - i];
+		if (deco->y == y && deco->height == height &&
+		    deco->x + deco->width == x && !memcmp(deco->col, col, 3)) {
+			deco->width += width;
+			return 0;
+		}
+	}
+
+	if (gt->deco_num >= gt->deco_size) {
+		size = gt->deco_size ? gt->deco_size * 2 : 64;
+		deco = realloc(gt->decos, sizeof(*deco) * size);
+		if (!deco)
+			return -ENOMEM;
+		gt->decos = deco;
+		gt->deco_size = size;
+	}
+
+	deco = &gt->decos[gt->deco_num++];
+	deco->x = x;
+	deco->y = y;
+	deco->width = width;
+	deco->height = height;
+	memcpy(deco->col, col, 3);
 	return 0;
 }
 
@@ -667,81 +1385,274 @@ static int gltex_draw(struct kmscon_text *txt,
 		      const struct tsm_screen_attr *attr)
 {
 	struct gltex *gt = txt->data;
-	struct atlas *atlas;
 	struct glyph *glyph;
-	int ret, i, idx;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	uint8_t fgcol[3], bgcol[3];
+	unsigned int i, num;
+	int ret;
 
 	if (!width)
 		return 0;
+	if (posx >= gt->cols || posy >= gt->rows)
+		return 0;
+	if (width > gt->cols - posx)
+		width = gt->cols - posx;
 
 	ret = find_glyph(txt, &glyph, id, ch, len, attr);
 	if (ret)
 		return ret;
-	atlas = glyph->atlas;
-
-	if (atlas->cache_num >= atlas->cache_size)
-		return -ERANGE;
-
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 0] =
-		gt->advance_x * posx - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 1] =
-		1 - gt->advance_y * posy;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 2] =
-		gt->advance_x * posx - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 3] =
-		1 - (gt->advance_y * posy + gt->advance_y);
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 4] =
-		gt->advance_x * posx + width * gt->advance_x - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 5] =
-		1 - (gt->advance_y * posy + gt->advance_y);
-
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 6] =
-		gt->advance_x * posx - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 7] =
-		1 - gt->advance_y * posy;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 8] =
-		gt->advance_x * posx + width * gt->advance_x - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 9] =
-		1 - (gt->advance_y * posy + gt->advance_y);
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 10] =
-		gt->advance_x * posx + width * gt->advance_x - 1;
-	atlas->cache_pos[atlas->cache_num * 2 * 6 + 11] =
-		1 - gt->advance_y * posy;
-
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 0] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 1] = 0.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 2] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 3] = 1.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 4] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 5] = 1.0;
-
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 6] = glyph->texoff;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 7] = 0.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 8] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 9] = 1.0;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 10] = glyph->texoff + width;
-	atlas->cache_texpos[atlas->cache_num * 2 * 6 + 11] = 0.0;
 
-	for (i = 0; i < 6; ++i) {
-		idx = atlas->cache_num * 3 * 6 + i * 3;
-		if (attr->inverse) {
-			atlas->cache_fgcol[idx + 0] = attr->br / 255.0;
-			atlas->cache_fgcol[idx + 1] = attr->bg / 255.0;
-			atlas->cache_fgcol[idx + 2] = attr->bb / 255.0;
-			atlas->cache_bgcol[idx + 0] = attr->fr / 255.0;
-			atlas->cache_bgcol[idx + 1] = attr->fg / 255.0;
-			atlas->cache_bgcol[idx + 2] = attr->fb / 255.0;
-		} else {
-			atlas->cache_fgcol[idx + 0] = attr->fr / 255.0;
-			atlas->cache_fgcol[idx + 1] = attr->fg / 255.0;
-			atlas->cache_fgcol[idx + 2] = attr->fb / 255.0;
-			atlas->cache_bgcol[idx + 0] = attr->br / 255.0;
-			atlas->cache_bgcol[idx + 1] = attr->bg / 255.0;
-			atlas->cache_bgcol[idx + 2] = attr->bb / 255.0;
+	if (attr->inverse) {
+		fgcol[0] = attr->br;
+		fgcol[1] = attr->bg;
+		fgcol[2] = attr->bb;
+		bgcol[0] = attr->fr;
+		bgcol[1] = attr->fg;
+		bgcol[2] = attr->fb;
+	} else {
+		fgcol[0] = attr->fr;
+		fgcol[1] = attr->fg;
+		fgcol[2] = attr->fb;
+		bgcol[0] = attr->br;
+		bgcol[1] = attr->bg;
+		bgcol[2] = attr->bb;
+	}
+
+	/* wide glyphs are split across the slots of the cells they cover */
+	for (i = 0; i < width; ++i) {
+		if (gt->grid)
+			grid_cell_set(gt, glyph->atlas, posx + i, posy,
+				      glyph->texoff + i, fgcol, bgcol);
+		else
+			cell_set(gt, glyph->atlas, posx + i, posy,
+				 glyph->texoff + i, fgcol, bgcol);
+	}
+
+	num = kmscon_text_get_spans(txt, kmscon_text_get_decorations(attr),
+				    spans);
+	for (i = 0; i < num; ++i) {
+		ret = add_deco(gt, posx * FONT_WIDTH(txt),
+			       posy * FONT_HEIGHT(txt) + spans[i].y,
+			       width * FONT_WIDTH(txt), spans[i].height, fgcol);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+/* draws the decoration lines of this frame as solid quads on top of the
+ * glyphs, reusing the pointer shader */
+static void render_decos(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct deco *deco;
+	GLfloat pos[8], px, py, x0, x1, y0, y1;
+	float mat[16];
+	size_t i;
+
+	if (!gt->deco_num)
+		return;
+
+	px = gt->advance_x / FONT_WIDTH(txt);
+	py = gt->advance_y / FONT_HEIGHT(txt);
+
+	gl_shader_use(gt->mouse_pointer_shader);
+	glDisable(GL_BLEND);
+
+	gl_m4_identity(mat);
+	glUniformMatrix4fv(gt->uni_proj_mouse, 1, GL_FALSE, mat);
+	glUniform1f(gt->uni_orientation_mouse, gt->angle);
+	glUniform2f(gt->uni_offset_mouse, 0.f, 0.f);
+
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, pos);
+
+	for (i = 0; i < gt->deco_num; ++i) {
+		deco = &gt->decos[i];
+		x0 = px * deco->x - 1;
+		x1 = px * (deco->x + deco->width) - 1;
+		y0 = 1 - py * deco->y;
+		y1 = 1 - py * (deco->y + deco->height);
+
+		pos[0] = x0;
+		pos[1] = y0;
+		pos[2] = x0;
+		pos[3] = y1;
+		pos[4] = x1;
+		pos[5] = y0;
+		pos[6] = x1;
+		pos[7] = y1;
+
+		glUniform4f(gt->uni_color_mouse, deco->col[0] / 255.f,
+			    deco->col[1] / 255.f, deco->col[2] / 255.f, 1.f);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	}
+
+	glDisableVertexAttribArray(0);
+}
+
+/* uploads changed rows of the cell textures */
+static void flush_grid(struct gltex *gt)
+{
+	unsigned int i, y, first;
+
+	if (!gt->grid_dirty)
+		return;
+
+	for (y = 0; y < gt->rows; ) {
+		if (!gt->grid_dirty_rows[y]) {
+			++y;
+			continue;
+		}
+
+		first = y;
+		while (y < gt->rows && gt->grid_dirty_rows[y])
+			gt->grid_dirty_rows[y++] = false;
+
+		for (i = 0; i < 3; ++i) {
+			glBindTexture(GL_TEXTURE_2D, gt->grid_tex[i]);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, first, gt->cols,
+					y - first, GL_RGBA, GL_UNSIGNED_BYTE,
+					&gt->grid_data[i][first * gt->cols * 4]);
+		}
+	}
+
+	gt->grid_dirty = false;
+}
+
+/* clears cells that were not drawn this frame and uploads changed rows */
+static void flush_cells(struct gltex *gt)
+{
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+	struct cell *cell;
+	unsigned int x, y, first;
+	size_t row = (size_t)gt->cols * 6 * sizeof(struct vertex);
+
+	for (y = 0; y < gt->rows; ++y) {
+		for (x = 0; x < gt->cols; ++x) {
+			cell = &gt->cells[y * gt->cols + x];
+			if (cell->atlas && cell->frame != gt->frame) {
+				if (gt->grid)
+					grid_cell_clear(gt, x, y);
+				else
+					slot_clear(gt, cell->atlas, x, y);
+				cell->atlas = NULL;
+			}
+		}
+	}
+
+	if (gt->grid) {
+		flush_grid(gt);
+		return;
+	}
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		if (!atlas->dirty)
+			continue;
+
+		glBindBuffer(GL_ARRAY_BUFFER, atlas->vbo);
+		for (y = 0; y < gt->rows; ) {
+			if (!atlas->dirty_rows[y]) {
+				++y;
+				continue;
+			}
+
+			first = y;
+			while (y < gt->rows && atlas->dirty_rows[y])
+				atlas->dirty_rows[y++] = false;
+
+			glBufferSubData(GL_ARRAY_BUFFER, first * row,
+					(y - first) * row,
+					&atlas->vertices[first * gt->cols * 6]);
 		}
+		atlas->dirty = false;
 	}
+}
 
-	++atlas->cache_num;
+static int gltex_render_grid(struct kmscon_text *txt)
+{
+	struct gltex *gt = txt->data;
+	struct atlas *atlas;
+	float mat[16];
+	GLfloat w, h, pos[8], cellpos[8];
+
+	if (shl_dlist_empty(&gt->atlases))
+		return 0;
+	atlas = shl_dlist_entry(gt->atlases.next, struct atlas, list);
+
+	/* a single quad covers the whole grid, see the grid shaders */
+	w = gt->advance_x * gt->cols;
+	h = gt->advance_y * gt->rows;
+
+	pos[0] = -1;
+	pos[1] = 1;
+	pos[2] = -1;
+	pos[3] = 1 - h;
+	pos[4] = -1 + w;
+	pos[5] = 1;
+	pos[6] = -1 + w;
+	pos[7] = 1 - h;
+
+	cellpos[0] = 0;
+	cellpos[1] = 0;
+	cellpos[2] = 0;
+	cellpos[3] = gt->rows;
+	cellpos[4] = gt->cols;
+	cellpos[5] = 0;
+	cellpos[6] = gt->cols;
+	cellpos[7] = gt->rows;
+
+	flush_glyphs(txt);
+
+	gl_clear_error();
+
+	if (gt->cells)
+		flush_cells(gt);
+
+	gl_shader_use(gt->shader);
+
+	glViewport(0, 0, gt->sw, gt->sh);
+	glDisable(GL_BLEND);
+
+	gl_m4_identity(mat);
+	glUniformMatrix4fv(gt->uni_proj, 1, GL_FALSE, mat);
+	glUniform1f(gt->uni_orientation, gt->angle);
+	glUniform2f(gt->uni_grid_size, gt->cols, gt->rows);
+	glUniform1f(gt->uni_advance_htex, atlas->advance_htex);
+	glUniform1f(gt->uni_advance_vtex, atlas->advance_vtex);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, atlas->tex);
+	glUniform1i(gt->uni_atlas, 0);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, gt->grid_tex[0]);
+	glUniform1i(gt->uni_cells, 1);
+	glActiveTexture(GL_TEXTURE2);
+	glBindTexture(GL_TEXTURE_2D, gt->grid_tex[1]);
+	glUniform1i(gt->uni_fgcolors, 2);
+	glActiveTexture(GL_TEXTURE3);
+	glBindTexture(GL_TEXTURE_2D, gt->grid_tex[2]);
+	glUniform1i(gt->uni_bgcolors, 3);
+
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, pos);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, cellpos);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+
+	glActiveTexture(GL_TEXTURE0);
+
+	render_decos(txt);
+
+	if (gl_has_error(gt->shader)) {
+		log_warning("rendering console caused OpenGL errors");
+		return -EFAULT;
+	}
 
 	return 0;
 }
@@ -753,8 +1664,13 @@ static int gltex_render(struct kmscon_text *txt)
 	struct shl_dlist *iter;
 	float mat[16];
 
+	flush_glyphs(txt);
+
 	gl_clear_error();
 
+	if (gt->cells)
+		flush_cells(gt);
+
 	gl_shader_use(gt->shader);
 
 	glViewport(0, 0, gt->sw, gt->sh);
@@ -774,25 +1690,39 @@ static int gltex_render(struct kmscon_text *txt)
 
 	shl_dlist_for_each(iter, &gt->atlases) {
 		atlas = shl_dlist_entry(iter, struct atlas, list);
-		if (!atlas->cache_num)
+		if (!atlas->used)
 			continue;
 
 		glBindTexture(GL_TEXTURE_2D, atlas->tex);
 		glUniform1f(gt->uni_advance_htex, atlas->advance_htex);
 		glUniform1f(gt->uni_advance_vtex, atlas->advance_vtex);
 
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, atlas->cache_pos);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, atlas->cache_texpos);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, atlas->cache_fgcol);
-		glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 0, atlas->cache_bgcol);
-		glDrawArrays(GL_TRIANGLES, 0, 6 * atlas->cache_num);
+		glBindBuffer(GL_ARRAY_BUFFER, atlas->vbo);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE,
+				      sizeof(struct vertex),
+				      (void*)offsetof(struct vertex, pos));
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE,
+				      sizeof(struct vertex),
+				      (void*)offsetof(struct vertex, texpos));
+		glVertexAttribPointer(2, 3, GL_UNSIGNED_BYTE, GL_TRUE,
+				      sizeof(struct vertex),
+				      (void*)offsetof(struct vertex, fgcol));
+		glVertexAttribPointer(3, 3, GL_UNSIGNED_BYTE, GL_TRUE,
+				      sizeof(struct vertex),
+				      (void*)offsetof(struct vertex, bgcol));
+		glDrawArrays(GL_TRIANGLES, 0, 6 * gt->cols * gt->rows);
 	}
 
+	/* the pointer and the uterm blitters use client-side arrays */
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
 	glDisableVertexAttribArray(0);
 	glDisableVertexAttribArray(1);
 	glDisableVertexAttribArray(2);
 	glDisableVertexAttribArray(3);
 
+	render_decos(txt);
+
 	if (gl_has_error(gt->shader)) {
 		log_warning("rendering console caused OpenGL errors");
 		return -EFAULT;
@@ -865,6 +1795,24 @@ static int gltex_render_pointer(struct kmscon_text *txt, int cursor_x, int curso
 	return 0;
 }
 
+static void gltex_get_atlas_stats(struct kmscon_text *txt,
+				  struct kmscon_text_atlas_stats *stats)
+{
+	struct gltex *gt = txt->data;
+	struct shl_dlist *iter;
+	struct atlas *atlas;
+
+	shl_dlist_for_each(iter, &gt->atlases) {
+		atlas = shl_dlist_entry(iter, struct atlas, list);
+		++stats->atlases;
+		stats->bytes += (size_t)atlas->width * atlas->height;
+		stats->slots += atlas->count;
+		stats->used += atlas->fill - atlas->free;
+	}
+
+	stats->evictions = gt->evictions;
+}
+
 struct kmscon_text_ops kmscon_text_gltex_ops = {
 	.name = "gltex",
 	.owner = NULL,
@@ -878,4 +1826,21 @@ struct kmscon_text_ops kmscon_text_gltex_ops = {
 	.render = gltex_render,
 	.render_pointer = gltex_render_pointer,
 	.abort = NULL,
+	.get_atlas_stats = gltex_get_atlas_stats,
+};
+
+struct kmscon_text_ops kmscon_text_gltex_grid_ops = {
+	.name = "gltex-grid",
+	.owner = NULL,
+	.init = gltex_init,
+	.destroy = gltex_destroy,
+	.set = gltex_set,
+	.unset = gltex_unset,
+	.rotate = gltex_rotate,
+	.prepare = gltex_prepare,
+	.draw = gltex_draw,
+	.render = gltex_render_grid,
+	.render_pointer = gltex_render_pointer,
+	.abort = NULL,
+	.get_atlas_stats = gltex_get_atlas_stats,
 };
@@ -0,0 +1,64 @@
+/*
+ * kmscon - Fragment Shader
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Cell-Grid Fragment Shader
+ * Each texel of the cell textures describes one cell. The glyph texture holds
+ * the glyph position in the atlas as two 16bit values, the color textures hold
+ * the foreground and background colors. Cells with a foreground alpha of 0
+ * were not drawn and are left untouched.
+ * Cell positions and atlas coordinates easily exceed the range of mediump, so
+ * this requires highp support in fragment shaders.
+ */
+
+precision highp float;
+
+uniform sampler2D atlas;
+uniform sampler2D cells;
+uniform sampler2D fgcolors;
+uniform sampler2D bgcolors;
+uniform vec2 grid_size;
+uniform float advance_htex;
+uniform float advance_vtex;
+
+varying vec2 cellpos;
+
+void main()
+{
+	vec2 cell = floor(cellpos);
+	vec2 pos = (cell + 0.5) / grid_size;
+	vec4 fgcol = texture2D(fgcolors, pos);
+
+	if (fgcol.a < 0.5)
+		discard;
+
+	vec4 slot = floor(texture2D(cells, pos) * 255.0 + 0.5);
+	vec2 glyph = vec2(slot.r + slot.g * 256.0, slot.b + slot.a * 256.0);
+	vec2 texpos = glyph + cellpos - cell;
+	float alpha = texture2D(atlas, vec2(texpos.x * advance_htex,
+					    texpos.y * advance_vtex)).a;
+	vec3 bgcol = texture2D(bgcolors, pos).rgb;
+	gl_FragColor = vec4(alpha * fgcol.rgb + (1.0 - alpha) * bgcol, 1.0);
+}
@@ -0,0 +1,54 @@
+/*
+ * kmscon - Vertex Shader
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Cell-Grid Vertex Shader
+ * The whole grid is drawn as a single quad. The cell position is interpolated
+ * from (0, 0) in the top-left to (cols, rows) in the bottom-right corner so the
+ * fragment shader can look up the cell it belongs to.
+ */
+
+uniform mat4 projection;
+uniform float orientation;
+
+attribute vec2 position;
+attribute vec2 cell_position;
+
+varying vec2 cellpos;
+
+vec2 opRotate(in vec2 p, in float degrees)
+{
+    float rad = radians(degrees);
+    float c = cos(rad);
+    float s = sin(rad);
+    return p * mat2(vec2(c, s), vec2(-s, c));
+}
+
+void main()
+{
+	vec2 rotatedPosition = opRotate(position, orientation);
+	gl_Position = projection * vec4(rotatedPosition, 0.0, 1.0);
+	cellpos = cell_position;
+}
@@ -25,6 +25,9 @@
 
 /*
  * Pixman based text renderer
+ * Glyphs are copied into pixman images once and kept in an LRU cache that is
+ * bounded by the glyph budget of the renderer. The font may drop its own copy
+ * as soon as the frame is over.
  */
 
 #include <errno.h>
@@ -32,7 +35,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
-#include "shl_hashtable.h"
+#include "shl_cache.h"
 #include "shl_log.h"
 #include "text.h"
 #include "uterm_video.h"
@@ -40,21 +43,19 @@
 #define LOG_SUBSYSTEM "text_pixman"
 
 struct tp_glyph {
-	const struct kmscon_glyph *glyph;
 	pixman_image_t *surf;
 	uint8_t *data;
 };
 
 struct tp_pixman {
 	pixman_image_t *white;
-	struct shl_hashtable *glyphs;
-	struct shl_hashtable *bold_glyphs;
+	struct shl_cache *glyphs;
+	struct shl_cache *bold_glyphs;
 
 	struct uterm_video_buffer buf[2];
 	pixman_image_t *surf[2];
 	unsigned int format[2];
 
-	bool new_stride;
 	bool use_indirect;
 	uint8_t *data[2];
 	struct uterm_video_buffer vbuf;
@@ -103,11 +104,34 @@ static unsigned int format_u2p(unsigned int f)
 		return PIXMAN_r5g6b5;
 	case UTERM_FORMAT_GREY:
 		return PIXMAN_a8;
+	case UTERM_FORMAT_MONO:
+		return PIXMAN_a1;
 	default:
 		return 0;
 	}
 }
 
+/*
+ * pixman stores a1 pixels in native bit-order, so on little-endian machines the
+ * leftmost pixel is the least significant bit. UTERM_FORMAT_MONO always puts
+ * it into the most significant bit.
+ */
+static void copy_mono(uint8_t *dst, const uint8_t *src, unsigned int width)
+{
+	unsigned int i;
+	uint8_t v;
+
+	for (i = 0; i < (width + 7) / 8; ++i) {
+		v = src[i];
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		v = (v & 0xf0) >> 4 | (v & 0x0f) << 4;
+		v = (v & 0xcc) >> 2 | (v & 0x33) << 2;
+		v = (v & 0xaa) >> 1 | (v & 0x55) << 1;
+#endif
+		dst[i] = v;
+	}
+}
+
 static int alloc_indirect(struct kmscon_text *txt,
 			  unsigned int w, unsigned int h)
 {
@@ -184,13 +208,11 @@ static int tp_set(struct kmscon_text *txt)
 		return -ENOMEM;
 	}
 
-	ret = shl_hashtable_new(&tp->glyphs, shl_direct_hash,
-				shl_direct_equal, free_glyph);
+	ret = shl_cache_new(&tp->glyphs, txt->glyph_budget, free_glyph);
 	if (ret)
 		goto err_white;
 
-	ret = shl_hashtable_new(&tp->bold_glyphs, shl_direct_hash,
-				shl_direct_equal, free_glyph);
+	ret = shl_cache_new(&tp->bold_glyphs, txt->glyph_budget, free_glyph);
 	if (ret)
 		goto err_htable;
 
@@ -227,6 +249,7 @@ static int tp_set(struct kmscon_text *txt)
 
 	txt->cols = w / txt->font->attr.width;
 	txt->rows = h / txt->font->attr.height;
+	txt->damage = true;
 
 	return 0;
 
@@ -238,9 +261,9 @@ err_ctx:
 	free(tp->data[1]);
 	free(tp->data[0]);
 err_htable_bold:
-	shl_hashtable_free(tp->bold_glyphs);
+	shl_cache_free(tp->bold_glyphs);
 err_htable:
-	shl_hashtable_free(tp->glyphs);
+	shl_cache_free(tp->glyphs);
 err_white:
 	pixman_image_unref(tp->white);
 	return ret;
@@ -249,13 +272,20 @@ err_white:
 static void tp_unset(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
+	struct shl_cache_stats stats, bold;
+
+	shl_cache_get_stats(tp->glyphs, &stats);
+	shl_cache_get_stats(tp->bold_glyphs, &bold);
+	log_debug("glyph cache: %lu hits, %lu misses, %lu evictions",
+		  stats.hits + bold.hits, stats.misses + bold.misses,
+		  stats.evictions + bold.evictions);
 
 	pixman_image_unref(tp->surf[1]);
 	pixman_image_unref(tp->surf[0]);
 	free(tp->data[1]);
 	free(tp->data[0]);
-	shl_hashtable_free(tp->bold_glyphs);
-	shl_hashtable_free(tp->glyphs);
+	shl_cache_free(tp->bold_glyphs);
+	shl_cache_free(tp->glyphs);
 	pixman_image_unref(tp->white);
 }
 
@@ -264,8 +294,10 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 {
 	struct tp_pixman *tp = txt->data;
 	struct tp_glyph *glyph;
-	struct shl_hashtable *gtable;
+	const struct kmscon_glyph *kglyph;
+	struct shl_cache *gtable;
 	struct kmscon_font *font;
+	struct kmscon_glyph_req greq;
 	const struct uterm_video_buffer *buf;
 	uint8_t *dst, *src;
 	unsigned int format, i;
@@ -280,85 +312,84 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 		font = txt->font;
 	}
 
-	if (attr->underline)
-		font->attr.underline = true;
-	else
-		font->attr.underline = false;
-
-	if (attr->italic)
-		font->attr.italic = true;
-	else
-		font->attr.italic = false;
+	/* each style is cached separately */
+	kmscon_text_glyph_req(&greq, id, ch, len, attr);
+	id = KMSCON_GLYPH_KEY(&greq);
 
-	res = shl_hashtable_find(gtable, (void**)&glyph, id);
+	res = shl_cache_find(gtable, (void**)&glyph, id);
 	if (res) {
 		*out = glyph;
 		return 0;
 	}
 
-	glyph = malloc(sizeof(*glyph));
-	if (!glyph)
-		return -ENOMEM;
-	memset(glyph, 0, sizeof(*glyph));
-
 	if (!len)
-		ret = kmscon_font_render_empty(font, &glyph->glyph);
+		ret = kmscon_font_render_empty(font, greq.style, &kglyph);
 	else
-		ret = kmscon_font_render(font, id, ch, len, &glyph->glyph);
+		ret = kmscon_font_render(font, &greq, &kglyph);
+
+	/* pending placeholder, see KMSCON_FONT_PENDING_ID() */
+	if (ret == -EAGAIN) {
+		id = KMSCON_FONT_PENDING_ID(kglyph->width);
+		res = shl_cache_find(gtable, (void**)&glyph, id);
+		if (res) {
+			*out = glyph;
+			return 0;
+		}
+		ret = 0;
+	}
 
 	if (ret) {
-		ret = kmscon_font_render_inval(font, &glyph->glyph);
+		ret = kmscon_font_render_inval(font, greq.style, &kglyph);
 		if (ret)
-			goto err_free;
+			return ret;
 	}
 
-	buf = &glyph->glyph->buf;
-	stride = buf->stride;
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph)
+		return -ENOMEM;
+	memset(glyph, 0, sizeof(*glyph));
+
+	/* The font only keeps its glyphs during the current frame, so we always
+	 * copy them. This also fixes up the bit-order of MONO glyphs and the
+	 * stride, which pixman wants 4-byte aligned. */
+	buf = &kglyph->buf;
 	format = format_u2p(buf->format);
-	glyph->surf = pixman_image_create_bits_no_clear(format,
-							buf->width,
-							buf->height,
-							(void*)buf->data,
-							buf->stride);
-	if (!glyph->surf) {
-		stride = (buf->stride + 3) & ~0x3;
-		if (!tp->new_stride) {
-			tp->new_stride = true;
-			log_debug("wrong stride, copy buffer (%d => %d)",
-			  buf->stride, stride);
-		}
+	stride = (buf->stride + 3) & ~0x3;
 
-		glyph->data = malloc(stride * buf->height);
-		if (!glyph->data) {
-			log_error("cannot allocate memory for glyph storage");
-			ret = -ENOMEM;
-			goto err_free;
-		}
+	glyph->data = malloc(stride * buf->height);
+	if (!glyph->data) {
+		log_error("cannot allocate memory for glyph storage");
+		ret = -ENOMEM;
+		goto err_free;
+	}
 
-		src = buf->data;
-		dst = glyph->data;
-		for (i = 0; i < buf->height; ++i) {
+	src = buf->data;
+	dst = glyph->data;
+	for (i = 0; i < buf->height; ++i) {
+		if (buf->format == UTERM_FORMAT_MONO)
+			copy_mono(dst, src, buf->width);
+		else
 			memcpy(dst, src, buf->width);
-			dst += stride;
-			src += buf->stride;
-		}
-
-		glyph->surf = pixman_image_create_bits_no_clear(format,
-								buf->width,
-								buf->height,
-								(void*)
-								glyph->data,
-								stride);
+		dst += stride;
+		src += buf->stride;
 	}
+
+	glyph->surf = pixman_image_create_bits_no_clear(format,
+							buf->width,
+							buf->height,
+							(void*)
+							glyph->data,
+							stride);
 	if (!glyph->surf) {
 		log_error("cannot create pixman-glyph: %d %p %d %d %d %d",
-			  ret, glyph->data ? glyph->data : buf->data, format,
+			  ret, glyph->data, format,
 			  buf->width, buf->height, stride);
 		ret = -EFAULT;
-		goto err_free;
+		goto err_data;
 	}
 
-	ret = shl_hashtable_insert(gtable, id, glyph);
+	ret = shl_cache_insert(gtable, id, glyph,
+			       sizeof(*glyph) + stride * buf->height);
 	if (ret)
 		goto err_pixman;
 
@@ -367,6 +398,8 @@ static int find_glyph(struct kmscon_text *txt, struct tp_glyph **out,
 
 err_pixman:
 	pixman_image_unref(glyph->surf);
+err_data:
+	free(glyph->data);
 err_free:
 	free(glyph);
 	return ret;
@@ -384,6 +417,9 @@ static int tp_prepare(struct kmscon_text *txt)
 		return ret;
 	}
 
+	shl_cache_next_frame(tp->glyphs);
+	shl_cache_next_frame(tp->bold_glyphs);
+
 	tp->cur = ret;
 	img = tp->surf[tp->cur];
 	tp->c_bpp = PIXMAN_FORMAT_BPP(tp->format[tp->cur]);
@@ -401,6 +437,8 @@ static int tp_draw(struct kmscon_text *txt,
 {
 	struct tp_pixman *tp = txt->data;
 	struct tp_glyph *glyph;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	unsigned int i, num;
 	int ret;
 	uint32_t bc;
 	pixman_color_t fc;
@@ -474,9 +512,142 @@ static int tp_draw(struct kmscon_text *txt,
 
 	pixman_image_unref(col);
 
+	/* decorations are drawn over the glyph in its foreground color; pixman
+	 * does not clip so wide glyphs in the last column are cut off */
+	if (posx + width > txt->cols)
+		width = txt->cols - posx;
+	num = kmscon_text_get_spans(txt, kmscon_text_get_decorations(attr),
+				    spans);
+	for (i = 0; i < num; ++i)
+		pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
+			    posx * txt->font->attr.width,
+			    posy * txt->font->attr.height + spans[i].y,
+			    width * txt->font->attr.width,
+			    spans[i].height,
+			    (fc.red >> 8) << 16 | (fc.green >> 8) << 8 |
+			    (fc.blue >> 8));
+
 	return 0;
 }
 
+/* Like tp_draw() but creates the color image once per segment of cells with
+ * equal attributes and clears blank segments with a single fill. */
+static int tp_draw_run(struct kmscon_text *txt,
+		       unsigned int posx, unsigned int posy,
+		       const struct kmscon_text_cell *cells,
+		       const struct tsm_screen_attr *attrs,
+		       size_t num)
+{
+	struct tp_pixman *tp = txt->data;
+	const struct tsm_screen_attr *attr = NULL;
+	const struct kmscon_text_cell *cell;
+	struct tp_glyph *glyph;
+	struct kmscon_text_span spans[KMSCON_TEXT_MAX_SPANS];
+	unsigned int k, num_spans = 0, x, y, width;
+	size_t i, j;
+	uint32_t bc = 0, fcol = 0;
+	pixman_color_t fc;
+	pixman_image_t *col = NULL;
+	int ret = 0;
+
+	y = posy * txt->font->attr.height;
+
+	for (i = 0; i < num; i = j) {
+		j = kmscon_text_get_segment(txt, posx, cells, attrs, num, i,
+					    &width);
+		if (!width)
+			continue;
+
+		if (!attr || !kmscon_text_same_style(attr, &attrs[i])) {
+			attr = &attrs[i];
+			if (attr->inverse) {
+				bc = (attr->fr << 16) | (attr->fg << 8) |
+				     (attr->fb);
+				fc.red = attr->br << 8;
+				fc.green = attr->bg << 8;
+				fc.blue = attr->bb << 8;
+			} else {
+				bc = (attr->br << 16) | (attr->bg << 8) |
+				     (attr->bb);
+				fc.red = attr->fr << 8;
+				fc.green = attr->fg << 8;
+				fc.blue = attr->fb << 8;
+			}
+			fc.alpha = 0xffff;
+			fcol = (fc.red >> 8) << 16 | (fc.green >> 8) << 8 |
+			       (fc.blue >> 8);
+			num_spans = kmscon_text_get_spans(txt,
+					kmscon_text_get_decorations(attr),
+					spans);
+
+			if (col)
+				pixman_image_unref(col);
+			col = NULL;
+		}
+
+		x = (posx + i) * txt->font->attr.width;
+
+		if (kmscon_text_is_blank(&cells[i])) {
+			pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
+				    x, y, width * txt->font->attr.width,
+				    txt->font->attr.height, bc);
+			goto decorate;
+		}
+
+		if (!col && !fcol) {
+			col = tp->white;
+			pixman_image_ref(col);
+		} else if (!col) {
+			col = pixman_image_create_solid_fill(&fc);
+			if (!col) {
+				log_error("cannot create pixman color image");
+				return -ENOMEM;
+			}
+		}
+
+		for (k = i; k < j; ++k) {
+			cell = &cells[k];
+			if (!cell->width)
+				continue;
+
+			ret = find_glyph(txt, &glyph, cell->id, cell->ch,
+					 cell->len, attr);
+			if (ret)
+				goto out;
+
+			if (bc)
+				pixman_fill(tp->c_data, tp->c_stride / 4,
+					    tp->c_bpp,
+					    (posx + k) * txt->font->attr.width,
+					    y, txt->font->attr.width,
+					    txt->font->attr.height, bc);
+
+			pixman_image_composite(bc ? PIXMAN_OP_OVER :
+						    PIXMAN_OP_SRC,
+					       col,
+					       glyph->surf,
+					       tp->surf[tp->cur],
+					       0, 0, 0, 0,
+					       (posx + k) * txt->font->attr.width,
+					       y,
+					       txt->font->attr.width,
+					       txt->font->attr.height);
+		}
+
+decorate:
+		for (k = 0; k < num_spans; ++k)
+			pixman_fill(tp->c_data, tp->c_stride / 4, tp->c_bpp,
+				    x, y + spans[k].y,
+				    width * txt->font->attr.width,
+				    spans[k].height, fcol);
+	}
+
+out:
+	if (col)
+		pixman_image_unref(col);
+	return ret;
+}
+
 static int tp_render(struct kmscon_text *txt)
 {
 	struct tp_pixman *tp = txt->data;
@@ -504,6 +675,7 @@ struct kmscon_text_ops kmscon_text_pixman_ops = {
 	.unset = tp_unset,
 	.prepare = tp_prepare,
 	.draw = tp_draw,
+	.draw_run = tp_draw_run,
 	.render = tp_render,
 	.abort = NULL,
 };
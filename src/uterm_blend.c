@@ -0,0 +1,541 @@
+/*
+ * uterm - Linux User-Space Terminal blending kernels
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Software Blending Kernels
+ * Each kernel blends a greyscale glyph into an XRGB32 buffer. The scalar
+ * implementation is the reference; it divides by 255 via:
+ *   t += 0x80
+ *   t = (t + (t >> 8)) >> 8
+ * which is exact for all t <= 255 * 255. The SIMD kernels do the very same
+ * computation on 16bit lanes, so there is no overflow and the results are
+ * bit-identical. Pixels that do not fill a whole vector are handled by the
+ * scalar code.
+ * The 1bpp kernels need no arithmetic at all: each bit is widened into an
+ * all-ones or all-zeros mask which selects between @fg and @bg via
+ * bg ^ ((fg ^ bg) & mask).
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uterm_blend.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UTERM_BLEND_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define UTERM_BLEND_ARM_NEON
+#include <arm_neon.h>
+#endif
+
+static inline uint32_t blend_pixel(uint_fast32_t a, uint32_t fg, uint32_t bg)
+{
+	uint_fast32_t r, g, b;
+
+	if (a == 0)
+		return bg & 0xffffff;
+	if (a == 255)
+		return fg & 0xffffff;
+
+	r = ((fg >> 16) & 0xff) * a + ((bg >> 16) & 0xff) * (255 - a);
+	r += 0x80;
+	r = (r + (r >> 8)) >> 8;
+
+	g = ((fg >> 8) & 0xff) * a + ((bg >> 8) & 0xff) * (255 - a);
+	g += 0x80;
+	g = (g + (g >> 8)) >> 8;
+
+	b = (fg & 0xff) * a + (bg & 0xff) * (255 - a);
+	b += 0x80;
+	b = (b + (b >> 8)) >> 8;
+
+	return (r << 16) | (g << 8) | b;
+}
+
+static inline void blend_line(uint32_t *dst, const uint8_t *src,
+			      unsigned int width, uint32_t fg, uint32_t bg)
+{
+	unsigned int i;
+
+	for (i = 0; i < width; ++i)
+		dst[i] = blend_pixel(src[i], fg, bg);
+}
+
+static void blend_scalar(uint8_t *dst, unsigned int dst_stride,
+			 const uint8_t *src, unsigned int src_stride,
+			 unsigned int width, unsigned int height,
+			 uint32_t fg, uint32_t bg)
+{
+	while (height--) {
+		blend_line((uint32_t*)dst, src, width, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+/* blend pixels @i to @width of a 1bpp line */
+static inline void blend_mono_line(uint32_t *dst, const uint8_t *src,
+				   unsigned int i, unsigned int width,
+				   uint32_t fg, uint32_t bg)
+{
+	uint32_t x, mask;
+
+	bg &= 0xffffff;
+	x = (fg & 0xffffff) ^ bg;
+
+	for ( ; i < width; ++i) {
+		mask = -(uint32_t)((src[i >> 3] >> (~i & 7)) & 1);
+		dst[i] = bg ^ (x & mask);
+	}
+}
+
+static void blend_mono_scalar(uint8_t *dst, unsigned int dst_stride,
+			      const uint8_t *src, unsigned int src_stride,
+			      unsigned int width, unsigned int height,
+			      uint32_t fg, uint32_t bg)
+{
+	while (height--) {
+		blend_mono_line((uint32_t*)dst, src, 0, width, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+#ifdef UTERM_BLEND_X86
+
+/*
+ * SSE2 kernel
+ * Two pixels are expanded into 8 16bit lanes (B, G, R, X each) so one
+ * multiply handles all channels. 8 pixels are processed per iteration.
+ */
+
+__attribute__((target("sse2")))
+static inline __m128i sse2_blend(__m128i a, __m128i fg, __m128i bg,
+				 __m128i c255, __m128i c80)
+{
+	__m128i t;
+
+	t = _mm_add_epi16(_mm_mullo_epi16(fg, a),
+			  _mm_mullo_epi16(bg, _mm_sub_epi16(c255, a)));
+	t = _mm_add_epi16(t, c80);
+	t = _mm_add_epi16(t, _mm_srli_epi16(t, 8));
+	return _mm_srli_epi16(t, 8);
+}
+
+__attribute__((target("sse2")))
+static void blend_sse2(uint8_t *dst, unsigned int dst_stride,
+		       const uint8_t *src, unsigned int src_stride,
+		       unsigned int width, unsigned int height,
+		       uint32_t fg, uint32_t bg)
+{
+	__m128i vfg, vbg, c255, c80, zero, a, a4, lo, hi;
+	unsigned int i;
+
+	zero = _mm_setzero_si128();
+	vfg = _mm_unpacklo_epi8(_mm_set1_epi32(fg & 0xffffff), zero);
+	vbg = _mm_unpacklo_epi8(_mm_set1_epi32(bg & 0xffffff), zero);
+	c255 = _mm_set1_epi16(255);
+	c80 = _mm_set1_epi16(0x80);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			a = _mm_loadl_epi64((const __m128i*)&src[i]);
+			a = _mm_unpacklo_epi8(a, a);
+
+			a4 = _mm_unpacklo_epi16(a, a);
+			lo = sse2_blend(_mm_unpacklo_epi8(a4, zero), vfg, vbg,
+					c255, c80);
+			hi = sse2_blend(_mm_unpackhi_epi8(a4, zero), vfg, vbg,
+					c255, c80);
+			_mm_storeu_si128((__m128i*)&dst[i * 4],
+					 _mm_packus_epi16(lo, hi));
+
+			a4 = _mm_unpackhi_epi16(a, a);
+			lo = sse2_blend(_mm_unpacklo_epi8(a4, zero), vfg, vbg,
+					c255, c80);
+			hi = sse2_blend(_mm_unpackhi_epi8(a4, zero), vfg, vbg,
+					c255, c80);
+			_mm_storeu_si128((__m128i*)&dst[i * 4 + 16],
+					 _mm_packus_epi16(lo, hi));
+		}
+
+		blend_line((uint32_t*)&dst[i * 4], &src[i], width - i, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+/*
+ * AVX2 kernel
+ * Same as SSE2 but with 4 pixels per register. The shuffle masks are chosen
+ * so that packing both halves yields the pixels in order without any
+ * cross-lane permutation.
+ */
+
+__attribute__((target("avx2")))
+static inline __m256i avx2_blend(__m256i a, __m256i fg, __m256i bg,
+				 __m256i c255, __m256i c80)
+{
+	__m256i t;
+
+	t = _mm256_add_epi16(_mm256_mullo_epi16(fg, a),
+			     _mm256_mullo_epi16(bg,
+						_mm256_sub_epi16(c255, a)));
+	t = _mm256_add_epi16(t, c80);
+	t = _mm256_add_epi16(t, _mm256_srli_epi16(t, 8));
+	return _mm256_srli_epi16(t, 8);
+}
+
+__attribute__((target("avx2")))
+static void blend_avx2(uint8_t *dst, unsigned int dst_stride,
+		       const uint8_t *src, unsigned int src_stride,
+		       unsigned int width, unsigned int height,
+		       uint32_t fg, uint32_t bg)
+{
+	__m256i vfg, vbg, c255, c80, a, mlo, mhi, lo, hi;
+	__m128i a8;
+	unsigned int i;
+
+#define Z -128
+	/* lo: pixels 0, 1 | 4, 5; hi: pixels 2, 3 | 6, 7 */
+	mlo = _mm256_setr_epi8(0, Z, 0, Z, 0, Z, 0, Z, 1, Z, 1, Z, 1, Z, 1, Z,
+			       4, Z, 4, Z, 4, Z, 4, Z, 5, Z, 5, Z, 5, Z, 5, Z);
+	mhi = _mm256_setr_epi8(2, Z, 2, Z, 2, Z, 2, Z, 3, Z, 3, Z, 3, Z, 3, Z,
+			       6, Z, 6, Z, 6, Z, 6, Z, 7, Z, 7, Z, 7, Z, 7, Z);
+#undef Z
+
+	vfg = _mm256_cvtepu8_epi16(_mm_set1_epi32(fg & 0xffffff));
+	vbg = _mm256_cvtepu8_epi16(_mm_set1_epi32(bg & 0xffffff));
+	c255 = _mm256_set1_epi16(255);
+	c80 = _mm256_set1_epi16(0x80);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			a8 = _mm_loadl_epi64((const __m128i*)&src[i]);
+			a = _mm256_broadcastsi128_si256(a8);
+
+			lo = avx2_blend(_mm256_shuffle_epi8(a, mlo), vfg, vbg,
+					c255, c80);
+			hi = avx2_blend(_mm256_shuffle_epi8(a, mhi), vfg, vbg,
+					c255, c80);
+			_mm256_storeu_si256((__m256i*)&dst[i * 4],
+					    _mm256_packus_epi16(lo, hi));
+		}
+
+		blend_line((uint32_t*)&dst[i * 4], &src[i], width - i, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+/*
+ * 1bpp kernels
+ * The source byte of 8 pixels is broadcast into every 32bit lane and compared
+ * against the bit belonging to each lane, which yields the select mask.
+ */
+
+__attribute__((target("sse2")))
+static void blend_mono_sse2(uint8_t *dst, unsigned int dst_stride,
+			    const uint8_t *src, unsigned int src_stride,
+			    unsigned int width, unsigned int height,
+			    uint32_t fg, uint32_t bg)
+{
+	__m128i vbg, vx, blo, bhi, v, lo, hi;
+	unsigned int i;
+
+	vbg = _mm_set1_epi32(bg & 0xffffff);
+	vx = _mm_set1_epi32((fg ^ bg) & 0xffffff);
+	blo = _mm_setr_epi32(0x80, 0x40, 0x20, 0x10);
+	bhi = _mm_setr_epi32(0x08, 0x04, 0x02, 0x01);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			v = _mm_set1_epi32(src[i >> 3]);
+			lo = _mm_cmpeq_epi32(_mm_and_si128(v, blo), blo);
+			hi = _mm_cmpeq_epi32(_mm_and_si128(v, bhi), bhi);
+			_mm_storeu_si128((__m128i*)&dst[i * 4],
+					 _mm_xor_si128(vbg,
+						       _mm_and_si128(vx, lo)));
+			_mm_storeu_si128((__m128i*)&dst[i * 4 + 16],
+					 _mm_xor_si128(vbg,
+						       _mm_and_si128(vx, hi)));
+		}
+
+		blend_mono_line((uint32_t*)dst, src, i, width, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+__attribute__((target("avx2")))
+static void blend_mono_avx2(uint8_t *dst, unsigned int dst_stride,
+			    const uint8_t *src, unsigned int src_stride,
+			    unsigned int width, unsigned int height,
+			    uint32_t fg, uint32_t bg)
+{
+	__m256i vbg, vx, bits, v, mask;
+	unsigned int i;
+
+	vbg = _mm256_set1_epi32(bg & 0xffffff);
+	vx = _mm256_set1_epi32((fg ^ bg) & 0xffffff);
+	bits = _mm256_setr_epi32(0x80, 0x40, 0x20, 0x10,
+				 0x08, 0x04, 0x02, 0x01);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			v = _mm256_set1_epi32(src[i >> 3]);
+			mask = _mm256_cmpeq_epi32(_mm256_and_si256(v, bits),
+						  bits);
+			_mm256_storeu_si256((__m256i*)&dst[i * 4],
+					    _mm256_xor_si256(vbg,
+						_mm256_and_si256(vx, mask)));
+		}
+
+		blend_mono_line((uint32_t*)dst, src, i, width, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+#endif /* UTERM_BLEND_X86 */
+
+#ifdef UTERM_BLEND_ARM_NEON
+
+/*
+ * NEON kernel
+ * NEON can de-interleave on load/store, so we compute each channel of 8
+ * pixels in a separate register and interleave them into XRGB32 on store.
+ */
+
+static inline uint8x8_t neon_blend(uint8x8_t a, uint8x8_t ia,
+				   uint8x8_t fg, uint8x8_t bg)
+{
+	uint16x8_t t;
+
+	t = vmull_u8(fg, a);
+	t = vmlal_u8(t, bg, ia);
+	t = vaddq_u16(t, vdupq_n_u16(0x80));
+	t = vsraq_n_u16(t, t, 8);
+	return vshrn_n_u16(t, 8);
+}
+
+static void blend_neon(uint8_t *dst, unsigned int dst_stride,
+		       const uint8_t *src, unsigned int src_stride,
+		       unsigned int width, unsigned int height,
+		       uint32_t fg, uint32_t bg)
+{
+	uint8x8_t fr, fgr, fb, br, bgr, bb, a, ia;
+	uint8x8x4_t out;
+	unsigned int i;
+
+	fr = vdup_n_u8((fg >> 16) & 0xff);
+	fgr = vdup_n_u8((fg >> 8) & 0xff);
+	fb = vdup_n_u8(fg & 0xff);
+	br = vdup_n_u8((bg >> 16) & 0xff);
+	bgr = vdup_n_u8((bg >> 8) & 0xff);
+	bb = vdup_n_u8(bg & 0xff);
+	out.val[3] = vdup_n_u8(0);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			a = vld1_u8(&src[i]);
+			ia = vmvn_u8(a);
+			out.val[0] = neon_blend(a, ia, fb, bb);
+			out.val[1] = neon_blend(a, ia, fgr, bgr);
+			out.val[2] = neon_blend(a, ia, fr, br);
+			vst4_u8(&dst[i * 4], out);
+		}
+
+		blend_line((uint32_t*)&dst[i * 4], &src[i], width - i, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+static void blend_mono_neon(uint8_t *dst, unsigned int dst_stride,
+			    const uint8_t *src, unsigned int src_stride,
+			    unsigned int width, unsigned int height,
+			    uint32_t fg, uint32_t bg)
+{
+	static const uint32_t lo_bits[4] = { 0x80, 0x40, 0x20, 0x10 };
+	static const uint32_t hi_bits[4] = { 0x08, 0x04, 0x02, 0x01 };
+	uint32x4_t vfg, vbg, blo, bhi, v;
+	unsigned int i;
+
+	vfg = vdupq_n_u32(fg & 0xffffff);
+	vbg = vdupq_n_u32(bg & 0xffffff);
+	blo = vld1q_u32(lo_bits);
+	bhi = vld1q_u32(hi_bits);
+
+	while (height--) {
+		for (i = 0; i + 8 <= width; i += 8) {
+			v = vdupq_n_u32(src[i >> 3]);
+			vst1q_u32((uint32_t*)&dst[i * 4],
+				  vbslq_u32(vtstq_u32(v, blo), vfg, vbg));
+			vst1q_u32((uint32_t*)&dst[i * 4 + 16],
+				  vbslq_u32(vtstq_u32(v, bhi), vfg, vbg));
+		}
+
+		blend_mono_line((uint32_t*)dst, src, i, width, fg, bg);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+#endif /* UTERM_BLEND_ARM_NEON */
+
+static const char *blend_names[UTERM_BLEND_NUM] = {
+	[UTERM_BLEND_SCALAR] = "scalar",
+	[UTERM_BLEND_SSE2] = "sse2",
+	[UTERM_BLEND_AVX2] = "avx2",
+	[UTERM_BLEND_NEON] = "neon",
+};
+
+/*
+ * Returns the kernel @impl or NULL if it was not compiled in or the CPU does
+ * not support it.
+ */
+uterm_blend_t uterm_blend_get(unsigned int impl)
+{
+	switch (impl) {
+	case UTERM_BLEND_SCALAR:
+		return blend_scalar;
+#ifdef UTERM_BLEND_X86
+	case UTERM_BLEND_SSE2:
+		if (__builtin_cpu_supports("sse2"))
+			return blend_sse2;
+		return NULL;
+	case UTERM_BLEND_AVX2:
+		if (__builtin_cpu_supports("avx2"))
+			return blend_avx2;
+		return NULL;
+#endif
+#ifdef UTERM_BLEND_ARM_NEON
+	case UTERM_BLEND_NEON:
+		return blend_neon;
+#endif
+	default:
+		return NULL;
+	}
+}
+
+/* Same as uterm_blend_get() but returns the 1bpp kernel of @impl. */
+uterm_blend_t uterm_blend_get_mono(unsigned int impl)
+{
+	switch (impl) {
+	case UTERM_BLEND_SCALAR:
+		return blend_mono_scalar;
+#ifdef UTERM_BLEND_X86
+	case UTERM_BLEND_SSE2:
+		if (__builtin_cpu_supports("sse2"))
+			return blend_mono_sse2;
+		return NULL;
+	case UTERM_BLEND_AVX2:
+		if (__builtin_cpu_supports("avx2"))
+			return blend_mono_avx2;
+		return NULL;
+#endif
+#ifdef UTERM_BLEND_ARM_NEON
+	case UTERM_BLEND_NEON:
+		return blend_mono_neon;
+#endif
+	default:
+		return NULL;
+	}
+}
+
+const char *uterm_blend_get_name(unsigned int impl)
+{
+	if (impl >= UTERM_BLEND_NUM)
+		return NULL;
+
+	return blend_names[impl];
+}
+
+/* Returns the fastest kernel that is usable on this machine. */
+unsigned int uterm_blend_find(void)
+{
+	static const unsigned int order[] = {
+		UTERM_BLEND_AVX2,
+		UTERM_BLEND_NEON,
+		UTERM_BLEND_SSE2,
+	};
+	unsigned int i;
+
+	for (i = 0; i < sizeof(order) / sizeof(*order); ++i) {
+		if (uterm_blend_get(order[i]))
+			return order[i];
+	}
+
+	return UTERM_BLEND_SCALAR;
+}
+
+/*
+ * Copy @len bytes into (usually write-combined) video memory. On x86 we use
+ * non-temporal stores so the destination is never read into the cache and the
+ * source stays cached for the next frame. uterm_stream_fence() must be called
+ * once all copies are done.
+ */
+void uterm_stream_copy(uint8_t *dst, const uint8_t *src, size_t len)
+{
+#ifdef __SSE2__
+	size_t head;
+
+	head = (16 - ((uintptr_t)dst & 15)) & 15;
+	if (head > len)
+		head = len;
+	memcpy(dst, src, head);
+	dst += head;
+	src += head;
+	len -= head;
+
+	for ( ; len >= 64; len -= 64, dst += 64, src += 64) {
+		_mm_stream_si128((__m128i*)dst,
+				 _mm_loadu_si128((const __m128i*)src));
+		_mm_stream_si128((__m128i*)(dst + 16),
+				 _mm_loadu_si128((const __m128i*)(src + 16)));
+		_mm_stream_si128((__m128i*)(dst + 32),
+				 _mm_loadu_si128((const __m128i*)(src + 32)));
+		_mm_stream_si128((__m128i*)(dst + 48),
+				 _mm_loadu_si128((const __m128i*)(src + 48)));
+	}
+	for ( ; len >= 16; len -= 16, dst += 16, src += 16)
+		_mm_stream_si128((__m128i*)dst,
+				 _mm_loadu_si128((const __m128i*)src));
+#endif
+
+	memcpy(dst, src, len);
+}
+
+void uterm_stream_fence(void)
+{
+#ifdef __SSE2__
+	_mm_sfence();
+#endif
+}
@@ -0,0 +1,73 @@
+/*
+ * uterm - Linux User-Space Terminal blending kernels
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Software Blending
+ * The software backends blend greyscale glyphs with a foreground and
+ * background color into XRGB32 framebuffers. This is the hottest path when no
+ * GPU is used, so besides the plain C reference implementation there are SIMD
+ * variants. All of them produce bit-identical results; uterm_blend_find()
+ * picks the fastest one that the CPU supports.
+ * UTERM_FORMAT_MONO glyphs have their own kernels that select the foreground
+ * or background color for each bit with masks instead of blending.
+ * uterm_stream_copy() moves finished pixels from system memory into video
+ * memory without polluting the cache.
+ */
+
+#ifndef UTERM_BLEND_H
+#define UTERM_BLEND_H
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+enum uterm_blend_impl {
+	UTERM_BLEND_SCALAR,
+	UTERM_BLEND_SSE2,
+	UTERM_BLEND_AVX2,
+	UTERM_BLEND_NEON,
+	UTERM_BLEND_NUM,
+};
+
+/*
+ * Blend a @width x @height greyscale image @src into the XRGB32 buffer @dst.
+ * @fg and @bg are XRGB32 colors. For each channel the result is
+ * (fg * a + bg * (255 - a)) / 255, rounded to nearest.
+ * The kernels returned by uterm_blend_get_mono() take a 1bpp @src instead and
+ * write @fg for set bits and @bg for cleared bits.
+ */
+typedef void (*uterm_blend_t) (uint8_t *dst, unsigned int dst_stride,
+			       const uint8_t *src, unsigned int src_stride,
+			       unsigned int width, unsigned int height,
+			       uint32_t fg, uint32_t bg);
+
+uterm_blend_t uterm_blend_get(unsigned int impl);
+uterm_blend_t uterm_blend_get_mono(unsigned int impl);
+const char *uterm_blend_get_name(unsigned int impl);
+unsigned int uterm_blend_find(void);
+
+void uterm_stream_copy(uint8_t *dst, const uint8_t *src, size_t len);
+void uterm_stream_fence(void);
+
+#endif /* UTERM_BLEND_H */
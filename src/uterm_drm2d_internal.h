@@ -32,6 +32,7 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include "uterm_blend.h"
 #include "uterm_video.h"
 
 struct uterm_drm2d_rb {
@@ -45,8 +46,21 @@ struct uterm_drm2d_rb {
 struct uterm_drm2d_display {
 	int current_rb;
 	struct uterm_drm2d_rb rb[2];
+	bool dirty;
+	uterm_blend_t blend;
+	uterm_blend_t blend_mono;
 };
 
+/* buffer that is drawn to; the front-buffer if we use dirty-fb tracking */
+static inline struct uterm_drm2d_rb *
+uterm_drm2d_display_get_rb(struct uterm_drm2d_display *d2d)
+{
+	if (d2d->dirty)
+		return &d2d->rb[d2d->current_rb];
+
+	return &d2d->rb[d2d->current_rb ^ 1];
+}
+
 struct uterm_drm2d_video {
 	int fd;
 	struct ev_fd *efd;
@@ -46,6 +46,16 @@
 
 #define LOG_SUBSYSTEM "uterm_drm2d_render"
 
+/* the shadow-buffer has the same layout as @rb so only the base differs */
+static uint8_t *display_get_map(struct uterm_display *disp,
+				struct uterm_drm2d_rb *rb)
+{
+	if (display_has_shadow(disp))
+		return disp->shadow.data;
+
+	return rb->map;
+}
+
 int uterm_drm2d_display_blit(struct uterm_display *disp,
 			     const struct uterm_video_buffer *buf,
 			     unsigned int x, unsigned int y)
@@ -60,7 +70,7 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	if (!buf || buf->format != UTERM_FORMAT_XRGB32)
 		return -EINVAL;
 
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = uterm_drm2d_display_get_rb(d2d);
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
@@ -80,7 +90,7 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	else
 		height = buf->height;
 
-	dst = rb->map;
+	dst = display_get_map(disp, rb);
 	dst = &dst[y * rb->stride + x * 4];
 	src = buf->data;
 
@@ -93,30 +103,32 @@ int uterm_drm2d_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
-int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
-				    const struct uterm_video_blend_req *req,
-				    size_t num)
+/* draws all requests of @band; runs on render threads */
+static int blend_band(struct uterm_display *disp,
+		      const struct uterm_video_blend_req *req, size_t num,
+		      unsigned int sh, unsigned int band, unsigned int bands)
 {
 	unsigned int tmp;
-	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
-	unsigned int sw, sh;
-	uint_fast32_t r, g, b, out;
+	uint8_t *dst, *tile;
+	unsigned int width, height, j;
+	unsigned int sw;
+	uint32_t fg, bg;
+	uterm_blend_t blend;
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
-	if (!req)
-		return -EINVAL;
-
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = uterm_drm2d_display_get_rb(d2d);
 	sw = uterm_drm_mode_get_width(disp->current_mode);
-	sh = uterm_drm_mode_get_height(disp->current_mode);
 
 	for (j = 0; j < num; ++j, ++req) {
-		if (!req->buf)
+		if (!req->buf || !display_in_band(req, sh, band, bands))
 			continue;
 
-		if (req->buf->format != UTERM_FORMAT_GREY)
+		if (req->buf->format == UTERM_FORMAT_GREY)
+			blend = d2d->blend;
+		else if (req->buf->format == UTERM_FORMAT_MONO)
+			blend = d2d->blend_mono;
+		else
 			return -EOPNOTSUPP;
 
 		tmp = req->x + req->buf->width;
@@ -135,55 +147,52 @@ int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
 		else
 			height = req->buf->height;
 
-		dst = rb->map;
+		dst = display_get_map(disp, rb);
 		dst = &dst[req->y * rb->stride + req->x * 4];
-		src = req->buf->data;
-
-		while (height--) {
-			for (i = 0; i < width; ++i) {
-				/* Division by 255 (t /= 255) is done with:
-				 *   t += 0x80
-				 *   t = (t + (t >> 8)) >> 8
-				 * This speeds up the computation by ~20% as the
-				 * division is not needed. */
-				if (src[i] == 0) {
-					r = req->br;
-					g = req->bg;
-					b = req->bb;
-					out = (r << 16) | (g << 8) | b;
-				} else if (src[i] == 255) {
-					r = req->fr;
-					g = req->fg;
-					b = req->fb;
-					out = (r << 16) | (g << 8) | b;
-				} else {
-					r = req->fr * src[i] +
-					    req->br * (255 - src[i]);
-					r += 0x80;
-					r = (r + (r >> 8)) >> 8;
-
-					g = req->fg * src[i] +
-					    req->bg * (255 - src[i]);
-					g += 0x80;
-					g = (g + (g >> 8)) >> 8;
-
-					b = req->fb * src[i] +
-					    req->bb * (255 - src[i]);
-					b += 0x80;
-					b = (b + (b >> 8)) >> 8;
-					out = (r << 16) | (g << 8) | b;
-				}
-
-				((uint32_t*)dst)[i] = out;
+		fg = (req->fr << 16) | (req->fg << 8) | req->fb;
+		bg = (req->br << 16) | (req->bg << 8) | req->bb;
+
+		/* only whole glyphs are cached */
+		if (width == req->buf->width && height == req->buf->height) {
+			tile = display_tile_find(disp, req, 4);
+			if (tile) {
+				display_tile_copy(dst, rb->stride, tile,
+						  width * 4, height);
+				continue;
+			}
+
+			tile = display_tile_new(disp, req, 4);
+			if (tile) {
+				blend(tile, width * 4, req->buf->data,
+				      req->buf->stride, width, height, fg, bg);
+				display_tile_copy(dst, rb->stride, tile,
+						  width * 4, height);
+				display_tile_add(disp, tile);
+				continue;
 			}
-			dst += rb->stride;
-			src += req->buf->stride;
 		}
+
+		blend(dst, rb->stride, req->buf->data, req->buf->stride,
+		      width, height, fg, bg);
 	}
 
 	return 0;
 }
 
+int uterm_drm2d_display_fake_blendv(struct uterm_display *disp,
+				    const struct uterm_video_blend_req *req,
+				    size_t num)
+{
+	unsigned int sh;
+
+	if (!req)
+		return -EINVAL;
+
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+
+	return display_render_bands(disp, req, num, sh, true, blend_band);
+}
+
 int uterm_drm2d_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
@@ -195,7 +204,7 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 	struct uterm_drm2d_rb *rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
-	rb = &d2d->rb[d2d->current_rb ^ 1];
+	rb = uterm_drm2d_display_get_rb(d2d);
 	sw = uterm_drm_mode_get_width(disp->current_mode);
 	sh = uterm_drm_mode_get_height(disp->current_mode);
 
@@ -210,7 +219,7 @@ int uterm_drm2d_display_fill(struct uterm_display *disp,
 	if (tmp > sh)
 		height = sh - y;
 
-	dst = rb->map;
+	dst = display_get_map(disp, rb);
 	dst = &dst[y * rb->stride + x * 4];
 
 	while (height--) {
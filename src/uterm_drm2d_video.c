@@ -47,9 +47,13 @@
 
 #define LOG_SUBSYSTEM "video_drm2d"
 
+/* kernel limit of clip-rects per DRM_IOCTL_MODE_DIRTYFB call */
+#define DIRTY_MAX_CLIPS 256
+
 static int display_init(struct uterm_display *disp)
 {
 	struct uterm_drm2d_display *d2d;
+	unsigned int blend;
 	int ret;
 
 	d2d = malloc(sizeof(*d2d));
@@ -57,12 +61,20 @@ static int display_init(struct uterm_display *disp)
 		return -ENOMEM;
 	memset(d2d, 0, sizeof(*d2d));
 
+	blend = uterm_blend_find();
+	d2d->blend = uterm_blend_get(blend);
+	d2d->blend_mono = uterm_blend_get_mono(blend);
+	log_debug("using %s blending on display %p",
+		  uterm_blend_get_name(blend), disp);
+
 	ret = uterm_drm_display_init(disp, d2d);
 	if (ret) {
 		free(d2d);
 		return ret;
 	}
 
+	/* dumb buffers keep their content, so partial redraws are fine */
+	disp->flags |= DISPLAY_PRESERVE;
 	return 0;
 }
 
@@ -156,6 +168,42 @@ static void destroy_rb(struct uterm_display *disp, struct uterm_drm2d_rb *rb)
 			    ret, errno);
 }
 
+/*
+ * USB and virtual devices do not scan out of our buffers directly. Instead the
+ * kernel copies the buffer to the real output whenever it is told that it
+ * changed, and a page-flip always copies the whole frame. On these devices we
+ * use a single front-buffer and report damaged regions via drmModeDirtyFB()
+ * instead. vkms is included so this path can be tested without special
+ * hardware.
+ * Some of them read the front-buffer at any time, though, like vkms or
+ * virtio_gpu with host-visible memory. So frames are always drawn into a
+ * shadow buffer and only the damaged regions are copied to the front-buffer
+ * right before they are reported, as partially drawn frames would tear.
+ */
+static bool needs_dirty_fb(int fd)
+{
+	static const char *drivers[] = {
+		"udl", "gud", "virtio_gpu", "vkms", NULL,
+	};
+	drmVersion *v;
+	unsigned int i;
+	bool res = false;
+
+	v = drmGetVersion(fd);
+	if (!v)
+		return false;
+
+	for (i = 0; drivers[i]; ++i) {
+		if (v->name && !strcmp(v->name, drivers[i])) {
+			res = true;
+			break;
+		}
+	}
+
+	drmFreeVersion(v);
+	return res;
+}
+
 static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 {
 	struct uterm_video *video = disp->video;
@@ -177,15 +225,31 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 		return ret;
 
 	d2d->current_rb = 0;
+	d2d->dirty = needs_dirty_fb(vdrm->fd);
 	disp->current_mode = mode;
 
 	ret = init_rb(disp, &d2d->rb[0]);
 	if (ret)
 		goto err_saved;
 
-	ret = init_rb(disp, &d2d->rb[1]);
-	if (ret)
-		goto err_rb;
+	if (d2d->dirty) {
+		log_info("using front-buffer with damage tracking on display %p",
+			 disp);
+		if (minfo->vrefresh)
+			display_set_vblank_timer(disp, 1000 / minfo->vrefresh);
+	} else {
+		ret = init_rb(disp, &d2d->rb[1]);
+		if (ret)
+			goto err_rb;
+	}
+
+	if (video_use_shadow(video) || d2d->dirty) {
+		ret = display_shadow_init(disp, d2d->rb[0].stride,
+					  minfo->vdisplay, 4);
+		if (ret)
+			log_warning("cannot allocate shadow-buffer for display %p (%d)",
+				    disp, ret);
+	}
 
 	ret = drmModeSetCrtc(vdrm->fd, ddrm->crtc_id,
 			     d2d->rb[0].fb, 0, 0, &ddrm->conn_id, 1,
@@ -200,7 +264,9 @@ static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
 	return 0;
 
 err_fb:
-	destroy_rb(disp, &d2d->rb[1]);
+	display_shadow_destroy(disp);
+	if (!d2d->dirty)
+		destroy_rb(disp, &d2d->rb[1]);
 err_rb:
 	destroy_rb(disp, &d2d->rb[0]);
 err_saved:
@@ -219,7 +285,9 @@ static void display_deactivate(struct uterm_display *disp)
 
 	uterm_drm_display_deactivate(disp, vdrm->fd);
 
-	destroy_rb(disp, &d2d->rb[1]);
+	display_shadow_destroy(disp);
+	if (!d2d->dirty)
+		destroy_rb(disp, &d2d->rb[1]);
 	destroy_rb(disp, &d2d->rb[0]);
 	disp->current_mode = NULL;
 }
@@ -231,6 +299,11 @@ static int display_use(struct uterm_display *disp, bool *opengl)
 	if (opengl)
 		*opengl = false;
 
+	if (display_has_shadow(disp))
+		return 0;
+	if (d2d->dirty)
+		return d2d->current_rb;
+
 	return d2d->current_rb ^ 1;
 }
 
@@ -246,31 +319,115 @@ static int display_get_buffers(struct uterm_display *disp,
 		return -EOPNOTSUPP;
 
 	for (i = 0; i < 2; ++i) {
-		rb = &d2d->rb[i];
+		rb = &d2d->rb[d2d->dirty ? 0 : i];
 		buffer[i].width = uterm_drm_mode_get_width(disp->current_mode);
 		buffer[i].height = uterm_drm_mode_get_height(disp->current_mode);
 		buffer[i].stride = rb->stride;
 		buffer[i].format = UTERM_FORMAT_XRGB32;
-		buffer[i].data = rb->map;
+		if (display_has_shadow(disp))
+			buffer[i].data = disp->shadow.data;
+		else
+			buffer[i].data = rb->map;
 	}
 
 	return 0;
 }
 
-static int display_swap(struct uterm_display *disp, bool immediate)
+static int dirty_fb(struct uterm_display *disp,
+		    const struct uterm_video_rect *rects, size_t num)
+{
+	struct uterm_drm_video *vdrm = disp->video->data;
+	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
+	drmModeClip clips[DIRTY_MAX_CLIPS];
+	unsigned int sw, sh, x2, y2, i, n;
+	int ret;
+
+	sw = uterm_drm_mode_get_width(disp->current_mode);
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+
+	n = 0;
+	if (rects && num <= DIRTY_MAX_CLIPS) {
+		if (!num)
+			return 0;
+
+		for (i = 0; i < num; ++i) {
+			if (rects[i].x >= sw || rects[i].y >= sh ||
+			    !rects[i].width || !rects[i].height)
+				continue;
+
+			clips[n].x1 = rects[i].x;
+			clips[n].y1 = rects[i].y;
+			x2 = rects[i].x + rects[i].width;
+			y2 = rects[i].y + rects[i].height;
+			clips[n].x2 = x2 > sw ? sw : x2;
+			clips[n].y2 = y2 > sh ? sh : y2;
+			++n;
+		}
+
+		if (!n)
+			return 0;
+	}
+
+	ret = drmModeDirtyFB(vdrm->fd, d2d->rb[d2d->current_rb].fb,
+			     n ? clips : NULL, n);
+	/* drivers without dirty-fb support scan out our buffer directly */
+	if (ret && ret != -ENOSYS) {
+		log_warning("cannot mark drm-fb as dirty (%d)", ret);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int display_swap_damage(struct uterm_display *disp, bool immediate,
+			       const struct uterm_video_rect *rects,
+			       size_t num)
 {
 	int ret, rb;
 	struct uterm_drm2d_display *d2d = uterm_drm_display_get_data(disp);
 
+	if (d2d->dirty) {
+		if (disp->dpms != UTERM_DPMS_ON)
+			return -EINVAL;
+
+		if (display_has_shadow(disp))
+			display_shadow_flush(disp, d2d->rb[d2d->current_rb].map,
+					     false, rects, num);
+
+		ret = dirty_fb(disp, rects, num);
+		if (ret)
+			return ret;
+
+		if (immediate)
+			return 0;
+		return display_schedule_vblank_timer(disp);
+	}
+
 	rb = d2d->current_rb ^ 1;
+	if (display_has_shadow(disp)) {
+		/* @rb is still scanned out until the pending flip is done */
+		if (!immediate && (disp->flags & DISPLAY_VSYNC)) {
+			display_shadow_drop(disp, rects, num);
+			return -EBUSY;
+		}
+		display_shadow_flush(disp, d2d->rb[rb].map, true, rects, num);
+	}
+
 	ret = uterm_drm_display_swap(disp, d2d->rb[rb].fb, immediate);
 	if (ret)
 		return ret;
 
+	if (display_has_shadow(disp))
+		display_shadow_swap(disp);
 	d2d->current_rb = rb;
 	return 0;
 }
 
+static int display_swap(struct uterm_display *disp, bool immediate)
+{
+	return display_swap_damage(disp, immediate, NULL, 0);
+}
+
 static const struct display_ops drm2d_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -280,6 +437,7 @@ static const struct display_ops drm2d_display_ops = {
 	.use = display_use,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.swap_damage = display_swap_damage,
 	.blit = uterm_drm2d_display_blit,
 	.fake_blendv = uterm_drm2d_display_fake_blendv,
 	.fill = uterm_drm2d_display_fill,
@@ -312,7 +470,10 @@ static void show_displays(struct uterm_video *video)
 		d2d = uterm_drm_display_get_data(iter);
 		rb = &d2d->rb[d2d->current_rb];
 		memset(rb->map, 0, rb->size);
-		uterm_drm_display_wait_pflip(iter);
+		if (d2d->dirty)
+			dirty_fb(iter, NULL, 0);
+		else
+			uterm_drm_display_wait_pflip(iter);
 	}
 }
 
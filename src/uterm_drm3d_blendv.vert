@@ -0,0 +1,47 @@
+/*
+ * kmscon - Vertex Shader
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Vertex Shader
+ * Batched glyph blending. Positions are already in normalized device
+ * coordinates and each vertex carries the colors of its cell so a whole atlas
+ * can be drawn with a single call.
+ */
+
+attribute vec2 position;
+attribute vec2 texture_position;
+attribute vec4 fgcolor;
+attribute vec4 bgcolor;
+varying vec2 texpos;
+varying vec3 fgcol;
+varying vec3 bgcol;
+
+void main()
+{
+	gl_Position = vec4(position, 0.0, 1.0);
+	texpos = texture_position;
+	fgcol = fgcolor.rgb;
+	bgcol = bgcolor.rgb;
+}
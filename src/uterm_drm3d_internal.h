@@ -45,6 +45,7 @@
 #include <unistd.h>
 #include <xf86drm.h>
 #include <xf86drmMode.h>
+#include "shl_hashtable.h"
 #include "uterm_video.h"
 
 /* thanks khronos for breaking backwards compatibility.. */
@@ -65,6 +66,53 @@ struct uterm_drm3d_display {
 	struct uterm_drm3d_rb *next;
 };
 
+/*
+ * Glyph atlases for fake_blendv()
+ * Blend sources are glyph buffers owned by the font backends, which may free
+ * them once they fall out of their glyph cache. So we upload each glyph once
+ * into a shelf-packed alpha atlas, keyed by the glyph id of the request rather
+ * than by the buffer, and queue one quad per request. Requests without an id
+ * are drawn directly. Each atlas is then drawn with a single call. If all
+ * atlases are full, everything is flushed and packing starts over.
+ */
+
+#define UTERM_DRM3D_ATLAS_MAX 4
+#define UTERM_DRM3D_ATLAS_SIZE 2048
+
+struct uterm_drm3d_vertex {
+	GLfloat pos[2];
+	GLfloat texpos[2];
+	GLubyte fgcol[4];
+	GLubyte bgcol[4];
+};
+
+struct uterm_drm3d_atlas {
+	GLuint tex;
+	unsigned int size;
+
+	/* shelf packing cursor */
+	unsigned int x;
+	unsigned int y;
+	unsigned int row;
+
+	/* quads queued for the next draw */
+	size_t num;
+	size_t alloc;
+	struct uterm_drm3d_vertex *vertices;
+};
+
+struct uterm_drm3d_glyph {
+	const uint8_t *data;
+	unsigned int width;
+	unsigned int height;
+	unsigned int stride;
+	unsigned int format;
+
+	unsigned int atlas;
+	unsigned int x;
+	unsigned int y;
+};
+
 struct uterm_drm3d_video {
 	struct gbm_device *gbm;
 	EGLDisplay disp;
@@ -87,6 +135,14 @@ struct uterm_drm3d_video {
 	struct gl_shader *blit_shader;
 	GLuint uni_blit_proj;
 	GLuint uni_blit_tex;
+
+	struct gl_shader *blendv_shader;
+	GLuint uni_blendv_atlas;
+	GLint max_tex_size;
+	struct shl_hashtable *glyphs;
+	struct uterm_drm3d_atlas atlas[UTERM_DRM3D_ATLAS_MAX];
+	unsigned int atlas_num;
+	unsigned int atlas_cur;
 };
 
 int uterm_drm3d_display_use(struct uterm_display *disp, bool *opengl);
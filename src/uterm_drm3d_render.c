@@ -53,6 +53,8 @@
 #include "uterm_video_internal.h"
 #include "uterm_drm3d_blend.vert.bin.h"
 #include "uterm_drm3d_blend.frag.bin.h"
+#include "uterm_drm3d_blendv.vert.bin.h"
+#include "uterm_drm3d_blendv.frag.bin.h"
 #include "uterm_drm3d_blit.vert.bin.h"
 #include "uterm_drm3d_blit.frag.bin.h"
 #include "uterm_drm3d_fill.vert.bin.h"
@@ -67,8 +69,12 @@ static int init_shaders(struct uterm_video *video)
 	char *fill_attr[] = { "position", "color" };
 	char *blend_attr[] = { "position", "texture_position" };
 	char *blit_attr[] = { "position", "texture_position" };
+	char *blendv_attr[] = { "position", "texture_position", "fgcolor",
+				"bgcolor" };
 	int blend_vlen, blend_flen, blit_vlen, blit_flen, fill_vlen, fill_flen;
+	int blendv_vlen, blendv_flen;
 	const char *blend_vert, *blend_frag;
+	const char *blendv_vert, *blendv_frag;
 	const char *blit_vert, *blit_frag;
 	const char *fill_vert, *fill_frag;
 
@@ -91,6 +97,10 @@ static int init_shaders(struct uterm_video *video)
 	fill_vlen = _binary_uterm_drm3d_fill_vert_size;
 	fill_frag = _binary_uterm_drm3d_fill_frag_start;
 	fill_flen = _binary_uterm_drm3d_fill_frag_size;
+	blendv_vert = _binary_uterm_drm3d_blendv_vert_start;
+	blendv_vlen = _binary_uterm_drm3d_blendv_vert_size;
+	blendv_frag = _binary_uterm_drm3d_blendv_frag_start;
+	blendv_flen = _binary_uterm_drm3d_blendv_frag_size;
 
 	ret = gl_shader_new(&v3d->fill_shader, fill_vert, fill_vlen,
 			    fill_frag, fill_flen, fill_attr, 2, log_llog,
@@ -127,6 +137,17 @@ static int init_shaders(struct uterm_video *video)
 	v3d->uni_blit_tex = gl_shader_get_uniform(v3d->blit_shader,
 						  "texture");
 
+	ret = gl_shader_new(&v3d->blendv_shader, blendv_vert, blendv_vlen,
+			    blendv_frag, blendv_flen, blendv_attr, 4, log_llog,
+			    NULL);
+	if (ret)
+		return ret;
+
+	v3d->uni_blendv_atlas = gl_shader_get_uniform(v3d->blendv_shader,
+						      "atlas");
+
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &v3d->max_tex_size);
+
 	gl_tex_new(&v3d->tex, 1);
 	v3d->sinit = 2;
 
@@ -136,11 +157,22 @@ static int init_shaders(struct uterm_video *video)
 void uterm_drm3d_deinit_shaders(struct uterm_video *video)
 {
 	struct uterm_drm3d_video *v3d = uterm_drm_video_get_data(video);
+	unsigned int i;
 
 	if (v3d->sinit == 0)
 		return;
 
 	v3d->sinit = 0;
+	for (i = 0; i < v3d->atlas_num; ++i) {
+		gl_tex_free(&v3d->atlas[i].tex, 1);
+		free(v3d->atlas[i].vertices);
+	}
+	memset(v3d->atlas, 0, sizeof(v3d->atlas));
+	v3d->atlas_num = 0;
+	v3d->atlas_cur = 0;
+	shl_hashtable_free(v3d->glyphs);
+	v3d->glyphs = NULL;
+	gl_shader_unref(v3d->blendv_shader);
 	gl_tex_free(&v3d->tex, 1);
 	gl_shader_unref(v3d->blit_shader);
 	gl_shader_unref(v3d->blend_shader);
@@ -287,7 +319,8 @@ static int display_blend(struct uterm_display *disp,
 	int ret;
 	uint8_t *packed, *src, *dst;
 
-	if (!buf || buf->format != UTERM_FORMAT_GREY)
+	if (!buf || (buf->format != UTERM_FORMAT_GREY &&
+		     buf->format != UTERM_FORMAT_MONO))
 		return -EINVAL;
 
 	v3d = uterm_drm_video_get_data(disp->video);
@@ -367,7 +400,24 @@ static int display_blend(struct uterm_display *disp,
 	glBindTexture(GL_TEXTURE_2D, v3d->tex);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	if (v3d->supports_rowlen) {
+	if (buf->format == UTERM_FORMAT_MONO) {
+		packed = malloc(width * height);
+		if (!packed)
+			return -ENOMEM;
+
+		src = buf->data;
+		dst = packed;
+		for (i = 0; i < height; ++i) {
+			uterm_video_unfold_mono(dst, src, width);
+			dst += width;
+			src += buf->stride;
+		}
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
+			     GL_ALPHA, GL_UNSIGNED_BYTE, packed);
+
+		free(packed);
+	} else if (v3d->supports_rowlen) {
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, buf->stride);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
 			     GL_ALPHA, GL_UNSIGNED_BYTE, buf->data);
@@ -413,28 +463,437 @@ static int display_blend(struct uterm_display *disp,
 	return 0;
 }
 
+static int atlas_new(struct uterm_drm3d_video *v3d)
+{
+	struct uterm_drm3d_atlas *atlas;
+
+	if (v3d->atlas_num >= UTERM_DRM3D_ATLAS_MAX)
+		return -ENOSPC;
+
+	atlas = &v3d->atlas[v3d->atlas_num];
+	memset(atlas, 0, sizeof(*atlas));
+	atlas->size = UTERM_DRM3D_ATLAS_SIZE;
+	if (v3d->max_tex_size > 0 && (GLint)atlas->size > v3d->max_tex_size)
+		atlas->size = v3d->max_tex_size;
+
+	gl_tex_new(&atlas->tex, 1);
+	glBindTexture(GL_TEXTURE_2D, atlas->tex);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, atlas->size, atlas->size, 0,
+		     GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
+
+	if (gl_has_error(v3d->blendv_shader)) {
+		log_warning("cannot allocate %ux%u glyph atlas", atlas->size,
+			    atlas->size);
+		gl_tex_free(&atlas->tex, 1);
+		return -EFAULT;
+	}
+
+	log_debug("new glyph atlas %u of size %ux%u", v3d->atlas_num,
+		  atlas->size, atlas->size);
+	++v3d->atlas_num;
+	return 0;
+}
+
+/* Forget all glyphs and pack from the start again. Textures are kept. */
+static int atlas_reset(struct uterm_drm3d_video *v3d)
+{
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < v3d->atlas_num; ++i) {
+		v3d->atlas[i].x = 0;
+		v3d->atlas[i].y = 0;
+		v3d->atlas[i].row = 0;
+	}
+	v3d->atlas_cur = 0;
+
+	shl_hashtable_free(v3d->glyphs);
+	v3d->glyphs = NULL;
+	ret = shl_hashtable_new(&v3d->glyphs, shl_direct_hash,
+				shl_direct_equal, free);
+	if (ret)
+		return ret;
+
+	return 0;
+}
+
+/* find a free slot for a @width x @height glyph plus 1px of padding */
+static int atlas_alloc(struct uterm_drm3d_video *v3d, unsigned int width,
+		       unsigned int height, unsigned int *idx,
+		       unsigned int *x, unsigned int *y)
+{
+	struct uterm_drm3d_atlas *atlas;
+	int ret;
+
+	++width;
+	++height;
+
+	while (1) {
+		if (v3d->atlas_cur >= v3d->atlas_num) {
+			ret = atlas_new(v3d);
+			if (ret)
+				return ret;
+		}
+
+		atlas = &v3d->atlas[v3d->atlas_cur];
+		if (width > atlas->size || height > atlas->size)
+			return -E2BIG;
+
+		if (atlas->x + width > atlas->size) {
+			atlas->y += atlas->row;
+			atlas->x = 0;
+			atlas->row = 0;
+		}
+
+		if (atlas->y + height <= atlas->size)
+			break;
+
+		++v3d->atlas_cur;
+	}
+
+	*idx = v3d->atlas_cur;
+	*x = atlas->x;
+	*y = atlas->y;
+	atlas->x += width;
+	if (height > atlas->row)
+		atlas->row = height;
+
+	return 0;
+}
+
+static int atlas_upload(struct uterm_drm3d_video *v3d,
+			struct uterm_drm3d_glyph *glyph)
+{
+	unsigned int i;
+	uint8_t *packed, *dst;
+	const uint8_t *src;
+
+	glBindTexture(GL_TEXTURE_2D, v3d->atlas[glyph->atlas].tex);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	if (glyph->format == UTERM_FORMAT_GREY && v3d->supports_rowlen) {
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, glyph->stride);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, glyph->x, glyph->y,
+				glyph->width, glyph->height, GL_ALPHA,
+				GL_UNSIGNED_BYTE, glyph->data);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	} else if (glyph->format == UTERM_FORMAT_GREY &&
+		   glyph->stride == glyph->width) {
+		glTexSubImage2D(GL_TEXTURE_2D, 0, glyph->x, glyph->y,
+				glyph->width, glyph->height, GL_ALPHA,
+				GL_UNSIGNED_BYTE, glyph->data);
+	} else {
+		packed = malloc(glyph->width * glyph->height);
+		if (!packed) {
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+			return -ENOMEM;
+		}
+
+		src = glyph->data;
+		dst = packed;
+		for (i = 0; i < glyph->height; ++i) {
+			if (glyph->format == UTERM_FORMAT_MONO)
+				uterm_video_unfold_mono(dst, src,
+							glyph->width);
+			else
+				memcpy(dst, src, glyph->width);
+			dst += glyph->width;
+			src += glyph->stride;
+		}
+
+		glTexSubImage2D(GL_TEXTURE_2D, 0, glyph->x, glyph->y,
+				glyph->width, glyph->height, GL_ALPHA,
+				GL_UNSIGNED_BYTE, packed);
+
+		free(packed);
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	return 0;
+}
+
+/* Glyphs are looked up by the id of @req, as font backends may free and reuse
+ * glyph buffers at any time. Requests without an id cannot be cached and
+ * -ENOENT is returned for them. */
+static int atlas_find(struct uterm_drm3d_video *v3d,
+		      const struct uterm_video_blend_req *req,
+		      struct uterm_drm3d_glyph **out)
+{
+	const struct uterm_video_buffer *buf = req->buf;
+	struct uterm_drm3d_glyph *glyph;
+	bool found;
+	int ret;
+
+	if (!req->id)
+		return -ENOENT;
+
+	found = shl_hashtable_find(v3d->glyphs, (void**)&glyph, req->id);
+	if (found && glyph->width == buf->width &&
+	    glyph->height == buf->height && glyph->format == buf->format) {
+		*out = glyph;
+		return 0;
+	}
+
+	if (!found) {
+		glyph = malloc(sizeof(*glyph));
+		if (!glyph)
+			return -ENOMEM;
+		memset(glyph, 0, sizeof(*glyph));
+	}
+
+	/* a glyph with other metrics gets a fresh slot, the old one leaks
+	 * until the next reset */
+	ret = atlas_alloc(v3d, buf->width, buf->height, &glyph->atlas,
+			  &glyph->x, &glyph->y);
+	if (ret)
+		goto err_free;
+
+	glyph->data = buf->data;
+	glyph->width = buf->width;
+	glyph->height = buf->height;
+	glyph->stride = buf->stride;
+	glyph->format = buf->format;
+
+	ret = atlas_upload(v3d, glyph);
+	if (ret)
+		goto err_free;
+
+	if (!found) {
+		ret = shl_hashtable_insert(v3d->glyphs, req->id, glyph);
+		if (ret)
+			goto err_free;
+	}
+
+	*out = glyph;
+	return 0;
+
+err_free:
+	if (found) {
+		/* never leave a stale mapping behind */
+		shl_hashtable_remove(v3d->glyphs, req->id);
+	} else {
+		free(glyph);
+	}
+	return ret;
+}
+
+static int atlas_push(struct uterm_drm3d_video *v3d,
+		      const struct uterm_drm3d_glyph *glyph,
+		      const struct uterm_video_blend_req *req,
+		      unsigned int width, unsigned int height,
+		      unsigned int sw, unsigned int sh)
+{
+	struct uterm_drm3d_atlas *atlas = &v3d->atlas[glyph->atlas];
+	struct uterm_drm3d_vertex *v, quad[4];
+	size_t nalloc;
+	GLfloat x0, y0, x1, y1, s0, t0, s1, t1;
+	unsigned int i;
+	static const unsigned int idx[6] = { 0, 1, 2, 0, 2, 3 };
+
+	if (atlas->num + 6 > atlas->alloc) {
+		nalloc = atlas->alloc ? atlas->alloc * 2 : 6 * 256;
+		v = realloc(atlas->vertices, nalloc * sizeof(*v));
+		if (!v)
+			return -ENOMEM;
+		atlas->vertices = v;
+		atlas->alloc = nalloc;
+	}
+
+	x0 = 2.0f * req->x / sw - 1.0f;
+	x1 = 2.0f * (req->x + width) / sw - 1.0f;
+	y0 = 1.0f - 2.0f * req->y / sh;
+	y1 = 1.0f - 2.0f * (req->y + height) / sh;
+
+	s0 = (GLfloat)glyph->x / atlas->size;
+	s1 = (GLfloat)(glyph->x + width) / atlas->size;
+	t0 = (GLfloat)glyph->y / atlas->size;
+	t1 = (GLfloat)(glyph->y + height) / atlas->size;
+
+	/* top-left, bottom-left, bottom-right, top-right */
+	quad[0].pos[0] = x0;
+	quad[0].pos[1] = y0;
+	quad[0].texpos[0] = s0;
+	quad[0].texpos[1] = t0;
+	quad[1].pos[0] = x0;
+	quad[1].pos[1] = y1;
+	quad[1].texpos[0] = s0;
+	quad[1].texpos[1] = t1;
+	quad[2].pos[0] = x1;
+	quad[2].pos[1] = y1;
+	quad[2].texpos[0] = s1;
+	quad[2].texpos[1] = t1;
+	quad[3].pos[0] = x1;
+	quad[3].pos[1] = y0;
+	quad[3].texpos[0] = s1;
+	quad[3].texpos[1] = t0;
+
+	for (i = 0; i < 4; ++i) {
+		quad[i].fgcol[0] = req->fr;
+		quad[i].fgcol[1] = req->fg;
+		quad[i].fgcol[2] = req->fb;
+		quad[i].fgcol[3] = 0xff;
+		quad[i].bgcol[0] = req->br;
+		quad[i].bgcol[1] = req->bg;
+		quad[i].bgcol[2] = req->bb;
+		quad[i].bgcol[3] = 0xff;
+	}
+
+	v = &atlas->vertices[atlas->num];
+	for (i = 0; i < 6; ++i)
+		v[i] = quad[idx[i]];
+	atlas->num += 6;
+
+	return 0;
+}
+
+/* draw all queued quads, one call per atlas */
+static int atlas_flush(struct uterm_drm3d_video *v3d, unsigned int sw,
+		       unsigned int sh)
+{
+	struct uterm_drm3d_atlas *atlas;
+	struct uterm_drm3d_vertex *v;
+	unsigned int i;
+	bool used = false;
+
+	for (i = 0; i < v3d->atlas_num; ++i) {
+		atlas = &v3d->atlas[i];
+		if (!atlas->num)
+			continue;
+
+		if (!used) {
+			used = true;
+			glViewport(0, 0, sw, sh);
+			glDisable(GL_BLEND);
+			gl_shader_use(v3d->blendv_shader);
+			glActiveTexture(GL_TEXTURE0);
+			glUniform1i(v3d->uni_blendv_atlas, 0);
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+			glEnableVertexAttribArray(2);
+			glEnableVertexAttribArray(3);
+		}
+
+		v = atlas->vertices;
+		glBindTexture(GL_TEXTURE_2D, atlas->tex);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(*v),
+				      v->pos);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(*v),
+				      v->texpos);
+		glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+				      sizeof(*v), v->fgcol);
+		glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+				      sizeof(*v), v->bgcol);
+		glDrawArrays(GL_TRIANGLES, 0, atlas->num);
+		atlas->num = 0;
+	}
+
+	if (!used)
+		return 0;
+
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glDisableVertexAttribArray(2);
+	glDisableVertexAttribArray(3);
+
+	if (gl_has_error(v3d->blendv_shader)) {
+		log_warning("GL error");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
 int uterm_drm3d_display_fake_blendv(struct uterm_display *disp,
 				    const struct uterm_video_blend_req *req,
 				    size_t num)
 {
+	struct uterm_drm3d_video *v3d;
+	struct uterm_drm3d_glyph *glyph;
+	unsigned int i, sw, sh, tmp, width, height;
 	int ret;
-	unsigned int i;
 
 	if (!disp || !req)
 		return -EINVAL;
 
+	v3d = uterm_drm_video_get_data(disp->video);
+	ret = uterm_drm3d_display_use(disp, NULL);
+	if (ret)
+		return ret;
+	ret = init_shaders(disp->video);
+	if (ret)
+		return ret;
+
+	if (!v3d->glyphs) {
+		ret = shl_hashtable_new(&v3d->glyphs, shl_direct_hash,
+					shl_direct_equal, free);
+		if (ret)
+			return ret;
+	}
+
+	/* drop quads left over from a failed call */
+	for (i = 0; i < v3d->atlas_num; ++i)
+		v3d->atlas[i].num = 0;
+
+	sw = uterm_drm_mode_get_width(disp->current_mode);
+	sh = uterm_drm_mode_get_height(disp->current_mode);
+
 	for (i = 0; i < num; ++i, ++req) {
 		if (!req->buf)
 			continue;
+		if (req->buf->format != UTERM_FORMAT_GREY &&
+		    req->buf->format != UTERM_FORMAT_MONO)
+			return -EINVAL;
+
+		tmp = req->x + req->buf->width;
+		if (tmp < req->x || req->x >= sw)
+			return -EINVAL;
+		if (tmp > sw)
+			width = sw - req->x;
+		else
+			width = req->buf->width;
+
+		tmp = req->y + req->buf->height;
+		if (tmp < req->y || req->y >= sh)
+			return -EINVAL;
+		if (tmp > sh)
+			height = sh - req->y;
+		else
+			height = req->buf->height;
+
+		ret = atlas_find(v3d, req, &glyph);
+		if (ret == -ENOSPC) {
+			/* all atlases are full; draw what is queued and
+			 * start over with empty atlases */
+			ret = atlas_flush(v3d, sw, sh);
+			if (ret)
+				return ret;
+			ret = atlas_reset(v3d);
+			if (ret)
+				return ret;
+			ret = atlas_find(v3d, req, &glyph);
+		}
+
+		if (ret == -E2BIG || ret == -ENOSPC || ret == -ENOENT) {
+			/* uncacheable or does not fit into any atlas, draw
+			 * it directly */
+			ret = display_blend(disp, req->buf, req->x, req->y,
+					    req->fr, req->fg, req->fb,
+					    req->br, req->bg, req->bb);
+			if (ret)
+				return ret;
+			continue;
+		} else if (ret) {
+			return ret;
+		}
 
-		ret = display_blend(disp, req->buf, req->x, req->y,
-				    req->fr, req->fg, req->fb,
-				    req->br, req->bg, req->bb);
+		ret = atlas_push(v3d, glyph, req, width, height, sw, sh);
 		if (ret)
 			return ret;
 	}
 
-	return 0;
+	return atlas_flush(v3d, sw, sh);
 }
 
 int uterm_drm3d_display_fill(struct uterm_display *disp,
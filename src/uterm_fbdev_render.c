@@ -38,6 +38,19 @@
 
 #define LOG_SUBSYSTEM "fbdev_render"
 
+/* back-buffer that is drawn to; the shadow-buffer if there is one */
+static uint8_t *display_get_dst(struct uterm_display *disp)
+{
+	struct fbdev_display *fbdev = disp->data;
+
+	if (display_has_shadow(disp))
+		return disp->shadow.data;
+	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
+		return fbdev->map;
+
+	return &fbdev->map[fbdev->yres * fbdev->stride];
+}
+
 static int clamp_value(int val, int low, int up)
 {
 	if (val < low)
@@ -144,10 +157,7 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 	else
 		height = buf->height;
 
-	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-		dst = fbdev->map;
-	else
-		dst = &fbdev->map[fbdev->yres * fbdev->stride];
+	dst = display_get_dst(disp);
 	dst = &dst[y * fbdev->stride + x * fbdev->Bpp];
 	src = buf->data;
 
@@ -192,25 +202,203 @@ int uterm_fbdev_display_blit(struct uterm_display *disp,
 	return 0;
 }
 
-int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
-				    const struct uterm_video_blend_req *req,
-				    size_t num)
+/*
+ * 1bpp glyphs only ever produce the foreground or background color, so both
+ * are converted into the device format once and each bit selects one of them.
+ * Dithering depends on the previous pixels, so in that case every pixel is
+ * converted on its own.
+ */
+static void blend_mono(struct uterm_display *disp, uint8_t *dst,
+		       unsigned int stride,
+		       const struct uterm_video_blend_req *req,
+		       unsigned int width, unsigned int height)
 {
-	unsigned int tmp;
-	uint8_t *dst, *src;
-	unsigned int width, height, i, j;
+	struct fbdev_display *fbdev = disp->data;
+	const uint8_t *src = req->buf->data;
+	uint_fast32_t fg, bg, x, val;
+	unsigned int i;
+	bool dither;
+
+	fg = (req->fr << 16) | (req->fg << 8) | req->fb;
+	bg = (req->br << 16) | (req->bg << 8) | req->bb;
+	dither = !fbdev->xrgb32 && (disp->flags & DISPLAY_DITHERING);
+	if (!fbdev->xrgb32 && !dither) {
+		fg = xrgb32_to_device(disp, fg);
+		bg = xrgb32_to_device(disp, bg);
+	}
+	x = fg ^ bg;
+
+	while (height--) {
+		for (i = 0; i < width; ++i) {
+			val = bg ^ (x & -(uint_fast32_t)
+				    ((src[i >> 3] >> (~i & 7)) & 1));
+			if (dither)
+				val = xrgb32_to_device(disp, val);
+
+			if (fbdev->Bpp == 2)
+				((uint16_t*)dst)[i] = val;
+			else if (fbdev->Bpp == 3)
+				write_24bit(&dst[i * 3], val);
+			else
+				((uint32_t*)dst)[i] = val;
+		}
+		dst += stride;
+		src += req->buf->stride;
+	}
+}
+
+/* blends a greyscale glyph, converting each pixel into the device format */
+static void blend_grey(struct uterm_display *disp, uint8_t *dst,
+		       unsigned int stride,
+		       const struct uterm_video_blend_req *req,
+		       unsigned int width, unsigned int height)
+{
+	struct fbdev_display *fbdev = disp->data;
+	const uint8_t *src = req->buf->data;
+	unsigned int i;
 	unsigned int r, g, b;
 	uint32_t val;
-	struct fbdev_display *fbdev = disp->data;
 
-	if (!req)
-		return -EINVAL;
+	/* Division by 256 instead of 255 increases
+	 * speed by like 20% on slower machines.
+	 * Downside is, full white is 254/254/254
+	 * instead of 255/255/255. */
+	if (fbdev->xrgb32) {
+		while (height--) {
+			for (i = 0; i < width; ++i) {
+				if (src[i] == 0) {
+					r = req->br;
+					g = req->bg;
+					b = req->bb;
+				} else if (src[i] == 255) {
+					r = req->fr;
+					g = req->fg;
+					b = req->fb;
+				} else {
+					r = req->fr * src[i] +
+					    req->br * (255 - src[i]);
+					r /= 256;
+					g = req->fg * src[i] +
+					    req->bg * (255 - src[i]);
+					g /= 256;
+					b = req->fb * src[i] +
+					    req->bb * (255 - src[i]);
+					b /= 256;
+				}
+				val = (r << 16) | (g << 8) | b;
+				((uint32_t*)dst)[i] = val;
+			}
+			dst += stride;
+			src += req->buf->stride;
+		}
+	} else if (fbdev->Bpp == 2) {
+		while (height--) {
+			for (i = 0; i < width; ++i) {
+				if (src[i] == 0) {
+					r = req->br;
+					g = req->bg;
+					b = req->bb;
+				} else if (src[i] == 255) {
+					r = req->fr;
+					g = req->fg;
+					b = req->fb;
+				} else {
+					r = req->fr * src[i] +
+					    req->br * (255 - src[i]);
+					r /= 256;
+					g = req->fg * src[i] +
+					    req->bg * (255 - src[i]);
+					g /= 256;
+					b = req->fb * src[i] +
+					    req->bb * (255 - src[i]);
+					b /= 256;
+				}
+				val = (r << 16) | (g << 8) | b;
+				((uint16_t*)dst)[i] =
+					xrgb32_to_device(disp, val);
+			}
+			dst += stride;
+			src += req->buf->stride;
+		}
+	} else if (fbdev->Bpp == 3) {
+		while (height--) {
+			for (i = 0; i < width; ++i) {
+				if (src[i] == 0) {
+					r = req->br;
+					g = req->bg;
+					b = req->bb;
+				} else if (src[i] == 255) {
+					r = req->fr;
+					g = req->fg;
+					b = req->fb;
+				} else {
+					r = req->fr * src[i] +
+					    req->br * (255 - src[i]);
+					r /= 256;
+					g = req->fg * src[i] +
+					    req->bg * (255 - src[i]);
+					g /= 256;
+					b = req->fb * src[i] +
+					    req->bb * (255 - src[i]);
+					b /= 256;
+				}
+				val = (r << 16) | (g << 8) | b;
+				uint_fast32_t full = xrgb32_to_device(disp, val);
+				write_24bit(&dst[i * 3], full);
+			}
+			dst += stride;
+			src += req->buf->stride;
+		}
+	} else if (fbdev->Bpp == 4) {
+		while (height--) {
+			for (i = 0; i < width; ++i) {
+				if (src[i] == 0) {
+					r = req->br;
+					g = req->bg;
+					b = req->bb;
+				} else if (src[i] == 255) {
+					r = req->fr;
+					g = req->fg;
+					b = req->fb;
+				} else {
+					r = req->fr * src[i] +
+					    req->br * (255 - src[i]);
+					r /= 256;
+					g = req->fg * src[i] +
+					    req->bg * (255 - src[i]);
+					g /= 256;
+					b = req->fb * src[i] +
+					    req->bb * (255 - src[i]);
+					b /= 256;
+				}
+				val = (r << 16) | (g << 8) | b;
+				((uint32_t*)dst)[i] =
+					xrgb32_to_device(disp, val);
+			}
+			dst += stride;
+			src += req->buf->stride;
+		}
+	} else {
+		log_warning("invalid Bpp");
+	}
+}
+
+/* draws all requests of @band; runs on render threads */
+static int blend_band(struct uterm_display *disp,
+		      const struct uterm_video_blend_req *req, size_t num,
+		      unsigned int yres, unsigned int band, unsigned int bands)
+{
+	unsigned int tmp;
+	uint8_t *dst, *out = NULL, *tile;
+	unsigned int width, height, j, stride;
+	struct fbdev_display *fbdev = disp->data;
 
 	for (j = 0; j < num; ++j, ++req) {
-		if (!req->buf)
+		if (!req->buf || !display_in_band(req, yres, band, bands))
 			continue;
 
-		if (req->buf->format != UTERM_FORMAT_GREY)
+		if (req->buf->format != UTERM_FORMAT_GREY &&
+		    req->buf->format != UTERM_FORMAT_MONO)
 			return -EOPNOTSUPP;
 
 		tmp = req->x + req->buf->width;
@@ -229,140 +417,69 @@ int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
 		else
 			height = req->buf->height;
 
-		if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-			dst = fbdev->map;
-		else
-			dst = &fbdev->map[fbdev->yres * fbdev->stride];
+		dst = display_get_dst(disp);
 		dst = &dst[req->y * fbdev->stride + req->x * fbdev->Bpp];
-		src = req->buf->data;
-
-		/* Division by 256 instead of 255 increases
-		 * speed by like 20% on slower machines.
-		 * Downside is, full white is 254/254/254
-		 * instead of 255/255/255. */
-		if (fbdev->xrgb32) {
-			while (height--) {
-				for (i = 0; i < width; ++i) {
-					if (src[i] == 0) {
-						r = req->br;
-						g = req->bg;
-						b = req->bb;
-					} else if (src[i] == 255) {
-						r = req->fr;
-						g = req->fg;
-						b = req->fb;
-					} else {
-						r = req->fr * src[i] +
-						    req->br * (255 - src[i]);
-						r /= 256;
-						g = req->fg * src[i] +
-						    req->bg * (255 - src[i]);
-						g /= 256;
-						b = req->fb * src[i] +
-						    req->bb * (255 - src[i]);
-						b /= 256;
-					}
-					val = (r << 16) | (g << 8) | b;
-					((uint32_t*)dst)[i] = val;
-				}
-				dst += fbdev->stride;
-				src += req->buf->stride;
-			}
-		} else if (fbdev->Bpp == 2) {
-			while (height--) {
-				for (i = 0; i < width; ++i) {
-					if (src[i] == 0) {
-						r = req->br;
-						g = req->bg;
-						b = req->bb;
-					} else if (src[i] == 255) {
-						r = req->fr;
-						g = req->fg;
-						b = req->fb;
-					} else {
-						r = req->fr * src[i] +
-						    req->br * (255 - src[i]);
-						r /= 256;
-						g = req->fg * src[i] +
-						    req->bg * (255 - src[i]);
-						g /= 256;
-						b = req->fb * src[i] +
-						    req->bb * (255 - src[i]);
-						b /= 256;
-					}
-					val = (r << 16) | (g << 8) | b;
-					((uint16_t*)dst)[i] =
-						xrgb32_to_device(disp, val);
-				}
-				dst += fbdev->stride;
-				src += req->buf->stride;
+		stride = fbdev->stride;
+
+		/* Whole glyphs are cached unless dithering makes each pixel
+		 * depend on the previous ones. On a miss the glyph is blended
+		 * into a new tile which is copied afterwards. */
+		tile = NULL;
+		if (width == req->buf->width && height == req->buf->height &&
+		    (fbdev->xrgb32 || !(disp->flags & DISPLAY_DITHERING)) &&
+		    fbdev->Bpp >= 2 && fbdev->Bpp <= 4) {
+			tile = display_tile_find(disp, req, fbdev->Bpp);
+			if (tile) {
+				display_tile_copy(dst, fbdev->stride, tile,
+						  width * fbdev->Bpp, height);
+				continue;
 			}
-		} else if (fbdev->Bpp == 3) {
-			while (height--) {
-				for (i = 0; i < width; ++i) {
-					if (src[i] == 0) {
-						r = req->br;
-						g = req->bg;
-						b = req->bb;
-					} else if (src[i] == 255) {
-						r = req->fr;
-						g = req->fg;
-						b = req->fb;
-					} else {
-						r = req->fr * src[i] +
-						    req->br * (255 - src[i]);
-						r /= 256;
-						g = req->fg * src[i] +
-						    req->bg * (255 - src[i]);
-						g /= 256;
-						b = req->fb * src[i] +
-						    req->bb * (255 - src[i]);
-						b /= 256;
-					}
-					val = (r << 16) | (g << 8) | b;
-					uint_fast32_t full = xrgb32_to_device(disp, val);
-					write_24bit(&dst[i * 3], full);
-				}
-				dst += fbdev->stride;
-				src += req->buf->stride;
-			}
-		} else if (fbdev->Bpp == 4) {
-			while (height--) {
-				for (i = 0; i < width; ++i) {
-					if (src[i] == 0) {
-						r = req->br;
-						g = req->bg;
-						b = req->bb;
-					} else if (src[i] == 255) {
-						r = req->fr;
-						g = req->fg;
-						b = req->fb;
-					} else {
-						r = req->fr * src[i] +
-						    req->br * (255 - src[i]);
-						r /= 256;
-						g = req->fg * src[i] +
-						    req->bg * (255 - src[i]);
-						g /= 256;
-						b = req->fb * src[i] +
-						    req->bb * (255 - src[i]);
-						b /= 256;
-					}
-					val = (r << 16) | (g << 8) | b;
-					((uint32_t*)dst)[i] =
-						xrgb32_to_device(disp, val);
-				}
-				dst += fbdev->stride;
-				src += req->buf->stride;
+
+			tile = display_tile_new(disp, req, fbdev->Bpp);
+			if (tile) {
+				out = dst;
+				dst = tile;
+				stride = width * fbdev->Bpp;
 			}
+		}
+
+		if (req->buf->format == UTERM_FORMAT_MONO) {
+			if (fbdev->Bpp < 2 || fbdev->Bpp > 4)
+				log_warning("invalid Bpp");
+			else
+				blend_mono(disp, dst, stride, req, width,
+					   height);
 		} else {
-			log_warning("invalid Bpp");
+			blend_grey(disp, dst, stride, req, width, height);
+		}
+
+		if (tile) {
+			display_tile_copy(out, fbdev->stride, tile,
+					  width * fbdev->Bpp, height);
+			display_tile_add(disp, tile);
 		}
 	}
 
 	return 0;
 }
 
+int uterm_fbdev_display_fake_blendv(struct uterm_display *disp,
+				    const struct uterm_video_blend_req *req,
+				    size_t num)
+{
+	struct fbdev_display *fbdev = disp->data;
+	bool parallel;
+
+	if (!req)
+		return -EINVAL;
+
+	/* dithering carries its error from pixel to pixel */
+	parallel = fbdev->xrgb32 || !(disp->flags & DISPLAY_DITHERING);
+
+	return display_render_bands(disp, req, num, fbdev->yres, parallel,
+				    blend_band);
+}
+
 int uterm_fbdev_display_fill(struct uterm_display *disp,
 			     uint8_t r, uint8_t g, uint8_t b,
 			     unsigned int x, unsigned int y,
@@ -384,10 +501,7 @@ int uterm_fbdev_display_fill(struct uterm_display *disp,
 	if (tmp > fbdev->yres)
 		height = fbdev->yres - y;
 
-	if (!(disp->flags & DISPLAY_DBUF) || fbdev->bufid)
-		dst = fbdev->map;
-	else
-		dst = &fbdev->map[fbdev->yres * fbdev->stride];
+	dst = display_get_dst(disp);
 	dst = &dst[y * fbdev->stride + x * fbdev->Bpp];
 
 	full_val  = ((r & 0xff) >> (8 - fbdev->len_r)) << fbdev->off_r;
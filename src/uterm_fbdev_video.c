@@ -99,6 +99,7 @@ static int display_init(struct uterm_display *disp)
 	memset(fbdev, 0, sizeof(*fbdev));
 	disp->data = fbdev;
 	disp->dpms = UTERM_DPMS_UNKNOWN;
+	disp->flags |= DISPLAY_PRESERVE;
 
 	return 0;
 }
@@ -364,6 +365,14 @@ static int display_activate_force(struct uterm_display *disp,
 	mfb->width = dfb->xres;
 	mfb->height = dfb->yres;
 
+	if (video_use_shadow(disp->video)) {
+		ret = display_shadow_init(disp, dfb->stride, dfb->yres,
+					  dfb->Bpp);
+		if (ret)
+			log_warning("cannot allocate shadow-buffer for %s (%d)",
+				    dfb->node, ret);
+	}
+
 	disp->flags |= DISPLAY_ONLINE;
 	return 0;
 
@@ -391,6 +400,7 @@ static void display_deactivate_force(struct uterm_display *disp, bool force)
 		close(dfb->fd);
 		dfb->map = NULL;
 	}
+	display_shadow_destroy(disp);
 	if (!force) {
 		uterm_mode_unbind(disp->current_mode);
 		disp->current_mode = NULL;
@@ -446,7 +456,7 @@ static int display_use(struct uterm_display *disp, bool *opengl)
 	if (opengl)
 		*opengl = false;
 
-	if (!(disp->flags & DISPLAY_DBUF))
+	if (!(disp->flags & DISPLAY_DBUF) || display_has_shadow(disp))
 		return 0;
 
 	return dfb->bufid ^ 1;
@@ -474,7 +484,9 @@ static int display_get_buffers(struct uterm_display *disp,
 		buffer[i].height = dfb->yres;
 		buffer[i].stride = dfb->stride;
 		buffer[i].format = f;
-		if (!(disp->flags & DISPLAY_DBUF) || !i)
+		if (display_has_shadow(disp))
+			buffer[i].data = disp->shadow.data;
+		else if (!(disp->flags & DISPLAY_DBUF) || !i)
 			buffer[i].data = dfb->map;
 		else
 			buffer[i].data = &dfb->map[dfb->yres * dfb->stride];
@@ -483,18 +495,31 @@ static int display_get_buffers(struct uterm_display *disp,
 	return 0;
 }
 
-static int display_swap(struct uterm_display *disp, bool immediate)
+static int display_swap_damage(struct uterm_display *disp, bool immediate,
+			       const struct uterm_video_rect *rects,
+			       size_t num)
 {
 	struct fbdev_display *dfb = disp->data;
 	struct fb_var_screeninfo *vinfo;
 	int ret;
 
 	if (!(disp->flags & DISPLAY_DBUF)) {
+		if (display_has_shadow(disp))
+			display_shadow_flush(disp, dfb->map, false, rects, num);
 		if (immediate)
 			return 0;
 		return display_schedule_vblank_timer(disp);
 	}
 
+	if (display_has_shadow(disp)) {
+		if (!dfb->bufid)
+			display_shadow_flush(disp,
+					     &dfb->map[dfb->yres * dfb->stride],
+					     true, rects, num);
+		else
+			display_shadow_flush(disp, dfb->map, true, rects, num);
+	}
+
 	vinfo = &dfb->vinfo;
 	if (immediate)
 		vinfo->activate = FB_ACTIVATE_NOW;
@@ -513,10 +538,17 @@ static int display_swap(struct uterm_display *disp, bool immediate)
 		return -EFAULT;
 	}
 
+	if (display_has_shadow(disp))
+		display_shadow_swap(disp);
 	dfb->bufid ^= 1;
 	return display_schedule_vblank_timer(disp);
 }
 
+static int display_swap(struct uterm_display *disp, bool immediate)
+{
+	return display_swap_damage(disp, immediate, NULL, 0);
+}
+
 static const struct display_ops fbdev_display_ops = {
 	.init = display_init,
 	.destroy = display_destroy,
@@ -526,6 +558,7 @@ static const struct display_ops fbdev_display_ops = {
 	.use = display_use,
 	.get_buffers = display_get_buffers,
 	.swap = display_swap,
+	.swap_damage = display_swap_damage,
 	.blit = uterm_fbdev_display_blit,
 	.fake_blendv = uterm_fbdev_display_fake_blendv,
 	.fill = uterm_fbdev_display_fill,
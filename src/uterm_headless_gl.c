@@ -0,0 +1,490 @@
+/*
+ * uterm - Linux User-Space Terminal headless OpenGL module
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Headless OpenGL Video backend
+ * Like the headless backend, but the display renders with OpenGLESv2 so the
+ * gltex renderer can run without a DRM device. The EGL context is created on
+ * the surfaceless platform (EGL_MESA_platform_surfaceless), which works with
+ * software stacks like llvmpipe. Each display renders into one of two
+ * framebuffer objects; swapping waits for the GPU and flips them.
+ *
+ * Only fill() is implemented besides the OpenGL context. Software renderers
+ * need the plain headless backend. Snapshots read the front framebuffer back
+ * into system memory.
+ */
+
+#define EGL_EGLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <endian.h>
+#include <errno.h>
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_log.h"
+#include "shl_misc.h"
+#include "uterm_headless_internal.h"
+#include "uterm_video.h"
+#include "uterm_video_internal.h"
+
+#define LOG_SUBSYSTEM "video_headless_gl"
+
+struct uterm_headless_gl_display {
+	unsigned int width;
+	unsigned int height;
+	unsigned int front;
+	GLuint rb[2];
+	GLuint fb[2];
+};
+
+struct uterm_headless_gl_video {
+	EGLDisplay disp;
+	EGLContext ctx;
+};
+
+static struct uterm_headless_gl_video *video_get_gl(struct uterm_video *video)
+{
+	struct uterm_headless_video *vh = video->data;
+
+	return vh->data;
+}
+
+static int display_init(struct uterm_display *disp)
+{
+	struct uterm_headless_gl_display *dg;
+
+	dg = malloc(sizeof(*dg));
+	if (!dg)
+		return -ENOMEM;
+	memset(dg, 0, sizeof(*dg));
+	disp->data = dg;
+	disp->dpms = UTERM_DPMS_ON;
+	disp->flags |= DISPLAY_AVAILABLE | DISPLAY_DBUF;
+
+	return 0;
+}
+
+static void display_destroy(struct uterm_display *disp)
+{
+	free(disp->data);
+}
+
+static int make_current(struct uterm_display *disp)
+{
+	struct uterm_headless_gl_video *vg = video_get_gl(disp->video);
+
+	if (!eglMakeCurrent(vg->disp, EGL_NO_SURFACE, EGL_NO_SURFACE,
+			    vg->ctx)) {
+		log_error("cannot activate EGL context");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static void free_framebuffers(struct uterm_headless_gl_display *dg)
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(2, dg->fb);
+	glDeleteRenderbuffers(2, dg->rb);
+	memset(dg->fb, 0, sizeof(dg->fb));
+	memset(dg->rb, 0, sizeof(dg->rb));
+}
+
+static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+	struct uterm_headless_mode *hmode;
+	unsigned int i;
+	GLenum status;
+	int ret;
+
+	if (!mode)
+		return -EINVAL;
+
+	hmode = mode->data;
+	log_info("activating display %p to %s", disp, hmode->name);
+
+	ret = make_current(disp);
+	if (ret)
+		return ret;
+
+	dg->width = hmode->width;
+	dg->height = hmode->height;
+	dg->front = 0;
+
+	glGenRenderbuffers(2, dg->rb);
+	glGenFramebuffers(2, dg->fb);
+	for (i = 0; i < 2; ++i) {
+		glBindRenderbuffer(GL_RENDERBUFFER, dg->rb[i]);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES,
+				      dg->width, dg->height);
+		glBindFramebuffer(GL_FRAMEBUFFER, dg->fb[i]);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+					  GL_RENDERBUFFER, dg->rb[i]);
+
+		status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		if (status != GL_FRAMEBUFFER_COMPLETE) {
+			log_error("cannot create framebuffer for display %p: %x",
+				  disp, status);
+			free_framebuffers(dg);
+			return -EFAULT;
+		}
+
+		glClearColor(0, 0, 0, 1);
+		glClear(GL_COLOR_BUFFER_BIT);
+	}
+
+	display_set_vblank_timer(disp, 1000 / hmode->rate);
+	disp->current_mode = mode;
+	disp->flags |= DISPLAY_ONLINE;
+
+	return 0;
+}
+
+static void display_deactivate(struct uterm_display *disp)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+
+	log_info("deactivating display %p", disp);
+
+	if (make_current(disp))
+		log_error("cannot activate GL context during destruction");
+	free_framebuffers(dg);
+	disp->current_mode = NULL;
+	disp->flags &= ~DISPLAY_ONLINE;
+}
+
+static int display_set_dpms(struct uterm_display *disp, int state)
+{
+	switch (state) {
+	case UTERM_DPMS_ON:
+	case UTERM_DPMS_STANDBY:
+	case UTERM_DPMS_SUSPEND:
+	case UTERM_DPMS_OFF:
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	disp->dpms = state;
+	return 0;
+}
+
+static int display_use(struct uterm_display *disp, bool *opengl)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+	int ret;
+
+	ret = make_current(disp);
+	if (ret)
+		return ret;
+
+	glBindFramebuffer(GL_FRAMEBUFFER, dg->fb[dg->front ^ 1]);
+
+	if (opengl)
+		*opengl = true;
+
+	/* the back-buffer is not preserved, so always report buffer 0 */
+	return 0;
+}
+
+static int display_swap(struct uterm_display *disp, bool immediate)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+	int ret;
+
+	ret = make_current(disp);
+	if (ret)
+		return ret;
+
+	/*
+	 * A real page-flip cannot happen before rendering is done. Software GL
+	 * stacks defer all work to this point, so wait for it here to keep the
+	 * frame timing honest.
+	 */
+	glFinish();
+	dg->front ^= 1;
+	if (immediate)
+		return 0;
+
+	return display_schedule_vblank_timer(disp);
+}
+
+static int display_snapshot(struct uterm_display *disp,
+			    struct uterm_video_buffer *buf)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+	uint32_t *dst, p;
+	unsigned int i, j;
+	int ret;
+
+	if (!buf->data) {
+		buf->width = dg->width;
+		buf->height = dg->height;
+		buf->stride = dg->width * 4;
+		buf->format = UTERM_FORMAT_XRGB32;
+		return 0;
+	}
+
+	if (buf->format != UTERM_FORMAT_XRGB32 ||
+	    buf->width != dg->width || buf->height != dg->height ||
+	    buf->stride < dg->width * 4)
+		return -EINVAL;
+
+	ret = make_current(disp);
+	if (ret)
+		return ret;
+
+	/* GL rows start at the bottom, and RGBA is the only portable format */
+	glBindFramebuffer(GL_FRAMEBUFFER, dg->fb[dg->front]);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	for (i = 0; i < dg->height; ++i) {
+		dst = (uint32_t*)&buf->data[i * buf->stride];
+		glReadPixels(0, dg->height - 1 - i, dg->width, 1, GL_RGBA,
+			     GL_UNSIGNED_BYTE, dst);
+		for (j = 0; j < dg->width; ++j) {
+			p = le32toh(dst[j]);
+			dst[j] = ((p & 0xff) << 16) | (p & 0xff00) |
+				 ((p >> 16) & 0xff);
+		}
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, dg->fb[dg->front ^ 1]);
+
+	if (glGetError() != GL_NO_ERROR) {
+		log_error("cannot read back framebuffer of display %p", disp);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int display_fill(struct uterm_display *disp,
+			uint8_t r, uint8_t g, uint8_t b,
+			unsigned int x, unsigned int y,
+			unsigned int width, unsigned int height)
+{
+	struct uterm_headless_gl_display *dg = disp->data;
+	unsigned int tmp;
+	int ret;
+
+	tmp = x + width;
+	if (tmp < x || x >= dg->width)
+		return -EINVAL;
+	if (tmp > dg->width)
+		width = dg->width - x;
+	tmp = y + height;
+	if (tmp < y || y >= dg->height)
+		return -EINVAL;
+	if (tmp > dg->height)
+		height = dg->height - y;
+
+	ret = display_use(disp, NULL);
+	if (ret)
+		return ret;
+
+	glEnable(GL_SCISSOR_TEST);
+	glScissor(x, dg->height - y - height, width, height);
+	glClearColor(r / 255.0, g / 255.0, b / 255.0, 1);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glDisable(GL_SCISSOR_TEST);
+
+	if (glGetError() != GL_NO_ERROR) {
+		log_error("GL error while filling display %p", disp);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static const struct display_ops headless_gl_display_ops = {
+	.init = display_init,
+	.destroy = display_destroy,
+	.activate = display_activate,
+	.deactivate = display_deactivate,
+	.set_dpms = display_set_dpms,
+	.use = display_use,
+	.get_buffers = NULL,
+	.swap = display_swap,
+	.swap_damage = NULL,
+	.snapshot = display_snapshot,
+	.blit = NULL,
+	.fake_blendv = NULL,
+	.fill = display_fill,
+};
+
+static int video_init(struct uterm_video *video, const char *node)
+{
+	static const EGLint conf_att[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+		EGL_NONE,
+	};
+	static const EGLint ctx_att[] = {
+		EGL_CONTEXT_CLIENT_VERSION, 2,
+		EGL_NONE
+	};
+	PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display;
+	struct uterm_headless_video *vh;
+	struct uterm_headless_gl_video *vg;
+	const char *ext;
+	EGLint major, minor, n;
+	EGLConfig conf;
+	int ret;
+
+	vg = malloc(sizeof(*vg));
+	if (!vg)
+		return -ENOMEM;
+	memset(vg, 0, sizeof(*vg));
+
+	ret = uterm_headless_video_init(video, node, &headless_gl_display_ops);
+	if (ret)
+		goto err_free;
+	vh = video->data;
+	vh->data = vg;
+
+	ext = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	if (!ext || !strstr(ext, "EGL_MESA_platform_surfaceless")) {
+		log_error("surfaceless EGL platform not supported");
+		ret = -EOPNOTSUPP;
+		goto err_video;
+	}
+
+	get_platform_display = (void*)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (!get_platform_display) {
+		log_error("cannot find eglGetPlatformDisplayEXT");
+		ret = -EOPNOTSUPP;
+		goto err_video;
+	}
+
+	vg->disp = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+					EGL_DEFAULT_DISPLAY, NULL);
+	if (vg->disp == EGL_NO_DISPLAY) {
+		log_error("cannot retrieve surfaceless egl display");
+		ret = -EFAULT;
+		goto err_video;
+	}
+
+	if (!eglInitialize(vg->disp, &major, &minor)) {
+		log_error("cannot init surfaceless egl display");
+		ret = -EFAULT;
+		goto err_video;
+	}
+
+	log_debug("EGL Init %d.%d", major, minor);
+	log_debug("EGL Version %s", eglQueryString(vg->disp, EGL_VERSION));
+	log_debug("EGL Vendor %s", eglQueryString(vg->disp, EGL_VENDOR));
+
+	ext = eglQueryString(vg->disp, EGL_EXTENSIONS);
+	if (!ext || !strstr(ext, "EGL_KHR_surfaceless_context")) {
+		log_error("surfaceless opengl not supported");
+		ret = -EOPNOTSUPP;
+		goto err_disp;
+	}
+
+	if (!eglBindAPI(EGL_OPENGL_ES_API)) {
+		log_error("cannot bind opengl-es api");
+		ret = -EFAULT;
+		goto err_disp;
+	}
+
+	if (!eglChooseConfig(vg->disp, conf_att, &conf, 1, &n) || n < 1) {
+		log_error("no EGL configs found");
+		ret = -EFAULT;
+		goto err_disp;
+	}
+
+	vg->ctx = eglCreateContext(vg->disp, conf, EGL_NO_CONTEXT, ctx_att);
+	if (vg->ctx == EGL_NO_CONTEXT) {
+		log_error("cannot create egl context");
+		ret = -EFAULT;
+		goto err_disp;
+	}
+
+	if (!eglMakeCurrent(vg->disp, EGL_NO_SURFACE, EGL_NO_SURFACE,
+			    vg->ctx)) {
+		log_error("cannot activate surfaceless EGL context");
+		ret = -EFAULT;
+		goto err_ctx;
+	}
+
+	log_info("headless GL renderer %s",
+		 (const char*)glGetString(GL_RENDERER));
+
+	ext = (const char*)glGetString(GL_EXTENSIONS);
+	if (!ext || !strstr(ext, "GL_OES_rgb8_rgba8")) {
+		log_error("GL_OES_rgb8_rgba8 not supported");
+		ret = -EOPNOTSUPP;
+		goto err_current;
+	}
+
+	return 0;
+
+err_current:
+	eglMakeCurrent(vg->disp, EGL_NO_SURFACE, EGL_NO_SURFACE,
+		       EGL_NO_CONTEXT);
+err_ctx:
+	eglDestroyContext(vg->disp, vg->ctx);
+err_disp:
+	eglTerminate(vg->disp);
+err_video:
+	uterm_headless_video_destroy(video);
+err_free:
+	free(vg);
+	return ret;
+}
+
+static void video_destroy(struct uterm_video *video)
+{
+	struct uterm_headless_gl_video *vg = video_get_gl(video);
+
+	eglMakeCurrent(vg->disp, EGL_NO_SURFACE, EGL_NO_SURFACE,
+		       EGL_NO_CONTEXT);
+	eglDestroyContext(vg->disp, vg->ctx);
+	eglTerminate(vg->disp);
+	free(vg);
+	uterm_headless_video_destroy(video);
+}
+
+static const struct video_ops headless_gl_video_ops = {
+	.init = video_init,
+	.destroy = video_destroy,
+	.segfault = NULL,
+	.poll = NULL,
+	.sleep = NULL,
+	.wake_up = NULL,
+};
+
+static const struct uterm_video_module headless_gl_module = {
+	.ops = &headless_gl_video_ops,
+};
+
+SHL_EXPORT
+const struct uterm_video_module *UTERM_VIDEO_HEADLESS_GL = &headless_gl_module;
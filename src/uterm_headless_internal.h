@@ -0,0 +1,89 @@
+/*
+ * uterm - Linux User-Space Terminal headless module
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* Internal definitions */
+
+#ifndef UTERM_HEADLESS_INTERNAL_H
+#define UTERM_HEADLESS_INTERNAL_H
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "uterm_blend.h"
+#include "uterm_video.h"
+#include "uterm_video_internal.h"
+
+#define HEADLESS_NAME_MAX 32
+
+struct uterm_headless_mode {
+	unsigned int width;
+	unsigned int height;
+	unsigned int rate;
+	char name[HEADLESS_NAME_MAX];
+};
+
+struct uterm_headless_display {
+	unsigned int width;
+	unsigned int height;
+	unsigned int stride;
+	unsigned int front;
+	uint8_t *buf[2];
+	uterm_blend_t blend;
+	uterm_blend_t blend_mono;
+};
+
+/* the buffer that is drawn to */
+static inline uint8_t *
+uterm_headless_display_get_back(struct uterm_headless_display *dh)
+{
+	return dh->buf[dh->front ^ 1];
+}
+
+struct uterm_headless_video {
+	unsigned int width;
+	unsigned int height;
+	unsigned int rate;
+	bool pending_intro;
+	const struct display_ops *display_ops;
+	void *data;
+};
+
+int uterm_headless_video_init(struct uterm_video *video, const char *node,
+			      const struct display_ops *ops);
+void uterm_headless_video_destroy(struct uterm_video *video);
+
+int uterm_headless_display_blit(struct uterm_display *disp,
+				const struct uterm_video_buffer *buf,
+				unsigned int x, unsigned int y);
+int uterm_headless_display_fake_blendv(struct uterm_display *disp,
+				       const struct uterm_video_blend_req *req,
+				       size_t num);
+int uterm_headless_display_fill(struct uterm_display *disp,
+				uint8_t r, uint8_t g, uint8_t b,
+				unsigned int x, unsigned int y,
+				unsigned int width, unsigned int height);
+
+#endif /* UTERM_HEADLESS_INTERNAL_H */
@@ -0,0 +1,166 @@
+/*
+ * uterm - Linux User-Space Terminal headless module
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Headless Video backend rendering functions
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_log.h"
+#include "uterm_headless_internal.h"
+#include "uterm_video.h"
+#include "uterm_video_internal.h"
+
+#define LOG_SUBSYSTEM "uterm_headless_render"
+
+int uterm_headless_display_blit(struct uterm_display *disp,
+				const struct uterm_video_buffer *buf,
+				unsigned int x, unsigned int y)
+{
+	unsigned int tmp;
+	uint8_t *dst, *src;
+	unsigned int width, height;
+	struct uterm_headless_display *dh = disp->data;
+
+	if (!buf || buf->format != UTERM_FORMAT_XRGB32)
+		return -EINVAL;
+
+	tmp = x + buf->width;
+	if (tmp < x || x >= dh->width)
+		return -EINVAL;
+	if (tmp > dh->width)
+		width = dh->width - x;
+	else
+		width = buf->width;
+
+	tmp = y + buf->height;
+	if (tmp < y || y >= dh->height)
+		return -EINVAL;
+	if (tmp > dh->height)
+		height = dh->height - y;
+	else
+		height = buf->height;
+
+	dst = uterm_headless_display_get_back(dh);
+	dst = &dst[y * dh->stride + x * 4];
+	src = buf->data;
+
+	while (height--) {
+		memcpy(dst, src, 4 * width);
+		dst += dh->stride;
+		src += buf->stride;
+	}
+
+	return 0;
+}
+
+int uterm_headless_display_fake_blendv(struct uterm_display *disp,
+				       const struct uterm_video_blend_req *req,
+				       size_t num)
+{
+	unsigned int tmp;
+	uint8_t *dst;
+	unsigned int width, height, j;
+	uint32_t fg, bg;
+	uterm_blend_t blend;
+	struct uterm_headless_display *dh = disp->data;
+
+	if (!req)
+		return -EINVAL;
+
+	for (j = 0; j < num; ++j, ++req) {
+		if (!req->buf)
+			continue;
+
+		if (req->buf->format == UTERM_FORMAT_GREY)
+			blend = dh->blend;
+		else if (req->buf->format == UTERM_FORMAT_MONO)
+			blend = dh->blend_mono;
+		else
+			return -EOPNOTSUPP;
+
+		tmp = req->x + req->buf->width;
+		if (tmp < req->x || req->x >= dh->width)
+			return -EINVAL;
+		if (tmp > dh->width)
+			width = dh->width - req->x;
+		else
+			width = req->buf->width;
+
+		tmp = req->y + req->buf->height;
+		if (tmp < req->y || req->y >= dh->height)
+			return -EINVAL;
+		if (tmp > dh->height)
+			height = dh->height - req->y;
+		else
+			height = req->buf->height;
+
+		dst = uterm_headless_display_get_back(dh);
+		dst = &dst[req->y * dh->stride + req->x * 4];
+		fg = (req->fr << 16) | (req->fg << 8) | req->fb;
+		bg = (req->br << 16) | (req->bg << 8) | req->bb;
+
+		blend(dst, dh->stride, req->buf->data, req->buf->stride,
+		      width, height, fg, bg);
+	}
+
+	return 0;
+}
+
+int uterm_headless_display_fill(struct uterm_display *disp,
+				uint8_t r, uint8_t g, uint8_t b,
+				unsigned int x, unsigned int y,
+				unsigned int width, unsigned int height)
+{
+	unsigned int tmp, i;
+	uint8_t *dst;
+	struct uterm_headless_display *dh = disp->data;
+
+	tmp = x + width;
+	if (tmp < x || x >= dh->width)
+		return -EINVAL;
+	if (tmp > dh->width)
+		width = dh->width - x;
+	tmp = y + height;
+	if (tmp < y || y >= dh->height)
+		return -EINVAL;
+	if (tmp > dh->height)
+		height = dh->height - y;
+
+	dst = uterm_headless_display_get_back(dh);
+	dst = &dst[y * dh->stride + x * 4];
+
+	while (height--) {
+		for (i = 0; i < width; ++i)
+			((uint32_t*)dst)[i] = (r << 16) | (g << 8) | b;
+		dst += dh->stride;
+	}
+
+	return 0;
+}
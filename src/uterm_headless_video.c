@@ -0,0 +1,450 @@
+/*
+ * uterm - Linux User-Space Terminal headless module
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Headless Video backend
+ * This backend does not drive any real device. Each video object provides a
+ * single display that renders into two buffers in system memory. Page-flips
+ * are faked with the vblank timer of the display so the timing behaves like a
+ * real monitor. This allows running the whole render path without access to
+ * /dev/dri or /dev/fb*, for instance for benchmarks and tests.
+ *
+ * The @node argument of uterm_video_new() selects the mode as
+ * "<width>x<height>[@<rate>]", rate in Hz. If it is NULL or empty, the default
+ * mode 1024x768@60 is used.
+ *
+ * Mode parsing and the display hotplug are shared with the OpenGL variant in
+ * uterm_headless_gl.c, which renders into framebuffer objects instead.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shl_log.h"
+#include "shl_misc.h"
+#include "uterm_headless_internal.h"
+#include "uterm_video.h"
+#include "uterm_video_internal.h"
+
+#define LOG_SUBSYSTEM "video_headless"
+
+#define HEADLESS_DEFAULT_WIDTH 1024
+#define HEADLESS_DEFAULT_HEIGHT 768
+#define HEADLESS_DEFAULT_RATE 60
+#define HEADLESS_MAX_SIZE 16384
+
+static int mode_init(struct uterm_mode *mode)
+{
+	struct uterm_headless_mode *hmode;
+
+	hmode = malloc(sizeof(*hmode));
+	if (!hmode)
+		return -ENOMEM;
+	memset(hmode, 0, sizeof(*hmode));
+	mode->data = hmode;
+
+	return 0;
+}
+
+static void mode_destroy(struct uterm_mode *mode)
+{
+	free(mode->data);
+}
+
+static const char *mode_get_name(const struct uterm_mode *mode)
+{
+	struct uterm_headless_mode *hmode = mode->data;
+
+	return hmode->name;
+}
+
+static unsigned int mode_get_width(const struct uterm_mode *mode)
+{
+	struct uterm_headless_mode *hmode = mode->data;
+
+	return hmode->width;
+}
+
+static unsigned int mode_get_height(const struct uterm_mode *mode)
+{
+	struct uterm_headless_mode *hmode = mode->data;
+
+	return hmode->height;
+}
+
+static const struct mode_ops headless_mode_ops = {
+	.init = mode_init,
+	.destroy = mode_destroy,
+	.get_name = mode_get_name,
+	.get_width = mode_get_width,
+	.get_height = mode_get_height,
+};
+
+static int display_init(struct uterm_display *disp)
+{
+	struct uterm_headless_display *dh;
+	unsigned int blend;
+
+	dh = malloc(sizeof(*dh));
+	if (!dh)
+		return -ENOMEM;
+	memset(dh, 0, sizeof(*dh));
+	disp->data = dh;
+	disp->dpms = UTERM_DPMS_ON;
+	disp->flags |= DISPLAY_AVAILABLE | DISPLAY_DBUF | DISPLAY_PRESERVE;
+
+	blend = uterm_blend_find();
+	dh->blend = uterm_blend_get(blend);
+	dh->blend_mono = uterm_blend_get_mono(blend);
+
+	return 0;
+}
+
+static void display_destroy(struct uterm_display *disp)
+{
+	free(disp->data);
+}
+
+static void free_buffers(struct uterm_headless_display *dh)
+{
+	free(dh->buf[1]);
+	free(dh->buf[0]);
+	dh->buf[1] = NULL;
+	dh->buf[0] = NULL;
+}
+
+static int display_activate(struct uterm_display *disp, struct uterm_mode *mode)
+{
+	struct uterm_headless_display *dh = disp->data;
+	struct uterm_headless_mode *hmode;
+	size_t size;
+	unsigned int i;
+	void *data;
+	int ret;
+
+	if (!mode)
+		return -EINVAL;
+
+	hmode = mode->data;
+	log_info("activating display %p to %s", disp, hmode->name);
+
+	dh->width = hmode->width;
+	dh->height = hmode->height;
+	dh->stride = hmode->width * 4;
+	dh->front = 0;
+	size = (size_t)dh->stride * dh->height;
+
+	for (i = 0; i < 2; ++i) {
+		ret = posix_memalign(&data, 64, size);
+		if (ret) {
+			log_error("cannot allocate buffer for display %p", disp);
+			free_buffers(dh);
+			return -ENOMEM;
+		}
+		memset(data, 0, size);
+		dh->buf[i] = data;
+	}
+
+	display_set_vblank_timer(disp, 1000 / hmode->rate);
+	disp->current_mode = mode;
+	disp->flags |= DISPLAY_ONLINE;
+
+	return 0;
+}
+
+static void display_deactivate(struct uterm_display *disp)
+{
+	struct uterm_headless_display *dh = disp->data;
+
+	log_info("deactivating display %p", disp);
+
+	free_buffers(dh);
+	disp->current_mode = NULL;
+	disp->flags &= ~DISPLAY_ONLINE;
+}
+
+static int display_set_dpms(struct uterm_display *disp, int state)
+{
+	switch (state) {
+	case UTERM_DPMS_ON:
+	case UTERM_DPMS_STANDBY:
+	case UTERM_DPMS_SUSPEND:
+	case UTERM_DPMS_OFF:
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	disp->dpms = state;
+	return 0;
+}
+
+static int display_use(struct uterm_display *disp, bool *opengl)
+{
+	struct uterm_headless_display *dh = disp->data;
+
+	if (opengl)
+		*opengl = false;
+
+	return dh->front ^ 1;
+}
+
+static int display_get_buffers(struct uterm_display *disp,
+			       struct uterm_video_buffer *buffer,
+			       unsigned int formats)
+{
+	struct uterm_headless_display *dh = disp->data;
+	unsigned int i;
+
+	if (!(formats & UTERM_FORMAT_XRGB32))
+		return -EOPNOTSUPP;
+
+	for (i = 0; i < 2; ++i) {
+		buffer[i].width = dh->width;
+		buffer[i].height = dh->height;
+		buffer[i].stride = dh->stride;
+		buffer[i].format = UTERM_FORMAT_XRGB32;
+		buffer[i].data = dh->buf[i];
+	}
+
+	return 0;
+}
+
+static int display_swap(struct uterm_display *disp, bool immediate)
+{
+	struct uterm_headless_display *dh = disp->data;
+
+	dh->front ^= 1;
+	if (immediate)
+		return 0;
+
+	return display_schedule_vblank_timer(disp);
+}
+
+static int display_snapshot(struct uterm_display *disp,
+			    struct uterm_video_buffer *buf)
+{
+	struct uterm_headless_display *dh = disp->data;
+	const uint8_t *src;
+	uint8_t *dst;
+	unsigned int i;
+
+	if (!buf->data) {
+		buf->width = dh->width;
+		buf->height = dh->height;
+		buf->stride = dh->stride;
+		buf->format = UTERM_FORMAT_XRGB32;
+		return 0;
+	}
+
+	if (buf->format != UTERM_FORMAT_XRGB32 ||
+	    buf->width != dh->width || buf->height != dh->height ||
+	    buf->stride < dh->width * 4)
+		return -EINVAL;
+
+	src = dh->buf[dh->front];
+	dst = buf->data;
+	for (i = 0; i < dh->height; ++i) {
+		memcpy(dst, src, dh->width * 4);
+		dst += buf->stride;
+		src += dh->stride;
+	}
+
+	return 0;
+}
+
+static const struct display_ops headless_display_ops = {
+	.init = display_init,
+	.destroy = display_destroy,
+	.activate = display_activate,
+	.deactivate = display_deactivate,
+	.set_dpms = display_set_dpms,
+	.use = display_use,
+	.get_buffers = display_get_buffers,
+	.swap = display_swap,
+	.swap_damage = NULL,
+	.snapshot = display_snapshot,
+	.blit = uterm_headless_display_blit,
+	.fake_blendv = uterm_headless_display_fake_blendv,
+	.fill = uterm_headless_display_fill,
+};
+
+static void intro_idle_event(struct ev_eloop *eloop, void *unused, void *data)
+{
+	struct uterm_video *video = data;
+	struct uterm_headless_video *vh = video->data;
+	struct uterm_headless_mode *hmode;
+	struct uterm_display *disp;
+	struct uterm_mode *mode;
+	int ret;
+
+	vh->pending_intro = false;
+	ev_eloop_unregister_idle_cb(eloop, intro_idle_event, data, EV_NORMAL);
+
+	ret = display_new(&disp, vh->display_ops);
+	if (ret) {
+		log_error("cannot create headless display: %d", ret);
+		return;
+	}
+
+	ret = mode_new(&mode, &headless_mode_ops);
+	if (ret) {
+		log_error("cannot create headless mode: %d", ret);
+		goto out;
+	}
+
+	hmode = mode->data;
+	hmode->width = vh->width;
+	hmode->height = vh->height;
+	hmode->rate = vh->rate;
+	snprintf(hmode->name, sizeof(hmode->name), "%ux%u@%u",
+		 vh->width, vh->height, vh->rate);
+
+	ret = uterm_mode_bind(mode, disp);
+	uterm_mode_unref(mode);
+	if (ret) {
+		log_error("cannot bind headless mode: %d", ret);
+		goto out;
+	}
+	disp->default_mode = mode;
+
+	ret = uterm_display_bind(disp, video);
+	if (ret)
+		log_error("cannot bind headless display: %d", ret);
+
+out:
+	uterm_display_unref(disp);
+}
+
+static int parse_node(struct uterm_headless_video *vh, const char *node)
+{
+	unsigned long val;
+	char *end;
+
+	vh->width = HEADLESS_DEFAULT_WIDTH;
+	vh->height = HEADLESS_DEFAULT_HEIGHT;
+	vh->rate = HEADLESS_DEFAULT_RATE;
+
+	if (!node || !*node)
+		return 0;
+
+	val = strtoul(node, &end, 10);
+	if (end == node || *end != 'x' || !val || val > HEADLESS_MAX_SIZE)
+		return -EINVAL;
+	vh->width = val;
+
+	node = end + 1;
+	val = strtoul(node, &end, 10);
+	if (end == node || !val || val > HEADLESS_MAX_SIZE)
+		return -EINVAL;
+	vh->height = val;
+
+	if (!*end)
+		return 0;
+	if (*end != '@')
+		return -EINVAL;
+
+	node = end + 1;
+	val = strtoul(node, &end, 10);
+	if (end == node || *end || !val || val > 1000)
+		return -EINVAL;
+	vh->rate = val;
+
+	return 0;
+}
+
+int uterm_headless_video_init(struct uterm_video *video, const char *node,
+			      const struct display_ops *ops)
+{
+	int ret;
+	struct uterm_headless_video *vh;
+
+	vh = malloc(sizeof(*vh));
+	if (!vh)
+		return -ENOMEM;
+	memset(vh, 0, sizeof(*vh));
+	vh->display_ops = ops;
+	video->data = vh;
+
+	ret = parse_node(vh, node);
+	if (ret) {
+		log_error("invalid headless mode '%s', expected <width>x<height>[@<rate>]",
+			  node);
+		goto err_free;
+	}
+
+	log_info("new headless device with mode %ux%u@%u", vh->width,
+		 vh->height, vh->rate);
+
+	ret = ev_eloop_register_idle_cb(video->eloop, intro_idle_event, video,
+					EV_NORMAL);
+	if (ret) {
+		log_error("cannot register idle event: %d", ret);
+		goto err_free;
+	}
+	vh->pending_intro = true;
+
+	return 0;
+
+err_free:
+	free(vh);
+	return ret;
+}
+
+void uterm_headless_video_destroy(struct uterm_video *video)
+{
+	struct uterm_headless_video *vh = video->data;
+
+	log_info("free headless device");
+
+	if (vh->pending_intro)
+		ev_eloop_unregister_idle_cb(video->eloop, intro_idle_event,
+					    video, EV_NORMAL);
+
+	free(vh);
+}
+
+static int video_init(struct uterm_video *video, const char *node)
+{
+	return uterm_headless_video_init(video, node, &headless_display_ops);
+}
+
+static const struct video_ops headless_video_ops = {
+	.init = video_init,
+	.destroy = uterm_headless_video_destroy,
+	.segfault = NULL,
+	.poll = NULL,
+	.sleep = NULL,
+	.wake_up = NULL,
+};
+
+static const struct uterm_video_module headless_module = {
+	.ops = &headless_video_ops,
+};
+
+SHL_EXPORT
+const struct uterm_video_module *UTERM_VIDEO_HEADLESS = &headless_module;
@@ -0,0 +1,248 @@
+/*
+ * uterm - Software Render Pool
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Software Render Pool
+ * Each video object owns a pool of worker threads that is started on the first
+ * request that is worth splitting. A job splits the screen into horizontal
+ * bands; the workers and the calling thread take bands until none are left and
+ * the caller waits until all of them are done. So when a job returns, all
+ * pixels are written and the display can be swapped.
+ * Only one job runs at a time, as all rendering happens on the event-loop
+ * thread.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "shl_log.h"
+#include "uterm_video.h"
+#include "uterm_video_internal.h"
+
+#define LOG_SUBSYSTEM "uterm_render_pool"
+
+/* bands lower than this are not worth a thread */
+#define POOL_MIN_BAND_HEIGHT 64
+/* neither are a few cells */
+#define POOL_MIN_REQUESTS 64
+
+struct render_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_cond_t done_cond;
+	pthread_t threads[DISPLAY_MAX_BANDS];
+	unsigned int num;
+	bool exit;
+
+	/* current job, protected by @lock */
+	struct uterm_display *disp;
+	const struct uterm_video_blend_req *req;
+	size_t req_num;
+	unsigned int height;
+	unsigned int bands;
+	display_band_cb cb;
+	unsigned int next;
+	unsigned int pending;
+	int ret;
+};
+
+/* takes bands of the current job until none are left; called locked */
+static void pool__run(struct render_pool *pool)
+{
+	unsigned int band;
+	int ret;
+
+	while (pool->next < pool->bands) {
+		band = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+
+		ret = pool->cb(pool->disp, pool->req, pool->req_num,
+			       pool->height, band, pool->bands);
+
+		pthread_mutex_lock(&pool->lock);
+		if (ret && !pool->ret)
+			pool->ret = ret;
+		if (!--pool->pending)
+			pthread_cond_broadcast(&pool->done_cond);
+	}
+}
+
+static void *pool_worker(void *data)
+{
+	struct render_pool *pool = data;
+
+	pthread_mutex_lock(&pool->lock);
+	while (!pool->exit) {
+		if (pool->next >= pool->bands) {
+			pthread_cond_wait(&pool->cond, &pool->lock);
+			continue;
+		}
+
+		pool__run(pool);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+static int pool_new(struct render_pool **out, unsigned int num)
+{
+	struct render_pool *pool;
+	sigset_t all, old;
+	int ret;
+
+	pool = malloc(sizeof(*pool));
+	if (!pool)
+		return -ENOMEM;
+	memset(pool, 0, sizeof(*pool));
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->cond, NULL);
+	pthread_cond_init(&pool->done_cond, NULL);
+
+	/*
+	 * eloop receives signals via signalfd and blocks each one only when it
+	 * is registered, which may be after the pool exists. Workers must never
+	 * take them, so they start with all signals blocked.
+	 */
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+
+	/* the caller renders a band itself */
+	for ( ; pool->num + 1 < num; ++pool->num) {
+		ret = pthread_create(&pool->threads[pool->num], NULL,
+				     pool_worker, pool);
+		if (ret) {
+			log_warning("cannot start render thread: %d", ret);
+			break;
+		}
+	}
+
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	log_debug("started %u render threads", pool->num);
+	*out = pool;
+	return 0;
+}
+
+void render_pool_free(struct render_pool *pool)
+{
+	unsigned int i;
+
+	if (!pool)
+		return;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->exit = true;
+	pthread_cond_broadcast(&pool->cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < pool->num; ++i)
+		pthread_join(pool->threads[i], NULL);
+
+	pthread_cond_destroy(&pool->done_cond);
+	pthread_cond_destroy(&pool->cond);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool);
+}
+
+/* number of threads to use if the user did not choose */
+static unsigned int pool_default_threads(void)
+{
+	long num;
+
+	num = sysconf(_SC_NPROCESSORS_ONLN);
+	if (num < 1)
+		return 1;
+	if (num > DISPLAY_MAX_BANDS)
+		return DISPLAY_MAX_BANDS;
+	return num;
+}
+
+/* number of threads all displays of @video render with */
+unsigned int render_pool_get_threads(struct uterm_video *video)
+{
+	if (!video->render_threads)
+		video->render_threads = pool_default_threads();
+
+	return video->render_threads;
+}
+
+int display_render_bands(struct uterm_display *disp,
+			 const struct uterm_video_blend_req *req, size_t num,
+			 unsigned int height, bool parallel,
+			 display_band_cb cb)
+{
+	struct uterm_video *video = disp->video;
+	struct render_pool *pool;
+	unsigned int bands;
+	int ret;
+
+	bands = render_pool_get_threads(video);
+	if (bands > height / POOL_MIN_BAND_HEIGHT)
+		bands = height / POOL_MIN_BAND_HEIGHT;
+	if (!parallel || num < POOL_MIN_REQUESTS || bands < 2)
+		return cb(disp, req, num, height, 0, 1);
+
+	if (!video->pool) {
+		ret = pool_new(&video->pool, render_pool_get_threads(video));
+		if (ret)
+			return cb(disp, req, num, height, 0, 1);
+	}
+
+	pool = video->pool;
+	if (bands > pool->num + 1)
+		bands = pool->num + 1;
+	if (bands < 2)
+		return cb(disp, req, num, height, 0, 1);
+
+	pthread_mutex_lock(&pool->lock);
+	pool->disp = disp;
+	pool->req = req;
+	pool->req_num = num;
+	pool->height = height;
+	pool->bands = bands;
+	pool->cb = cb;
+	pool->next = 0;
+	pool->pending = bands;
+	pool->ret = 0;
+	pthread_cond_broadcast(&pool->cond);
+
+	pool__run(pool);
+
+	/* barrier, nothing may be swapped before all bands are drawn */
+	while (pool->pending)
+		pthread_cond_wait(&pool->done_cond, &pool->lock);
+	ret = pool->ret;
+	pool->bands = 0;
+	pool->next = 0;
+	pthread_mutex_unlock(&pool->lock);
+
+	return ret;
+}
@@ -39,6 +39,7 @@
 #include "shl_hook.h"
 #include "shl_log.h"
 #include "shl_misc.h"
+#include "uterm_blend.h"
 #include "uterm_video.h"
 #include "uterm_video_internal.h"
 
@@ -206,6 +207,157 @@ void display_set_vblank_timer(struct uterm_display *disp,
 	disp->vblank_spec.it_value.tv_nsec = msecs * 1000 * 1000;
 }
 
+int display_shadow_init(struct uterm_display *disp, unsigned int stride,
+			unsigned int height, unsigned int bpp)
+{
+	struct display_shadow *sh = &disp->shadow;
+	void *data;
+	int ret;
+
+	ret = posix_memalign(&data, 64, (size_t)stride * height);
+	if (ret)
+		return -ret;
+	memset(data, 0, (size_t)stride * height);
+
+	memset(sh, 0, sizeof(*sh));
+	sh->data = data;
+	sh->stride = stride;
+	sh->height = height;
+	sh->bpp = bpp;
+	/* we don't know what the scanout buffers contain */
+	sh->back.full = true;
+	sh->front.full = true;
+
+	return 0;
+}
+
+void display_shadow_destroy(struct uterm_display *disp)
+{
+	struct display_shadow *sh = &disp->shadow;
+
+	free(sh->back.rects);
+	free(sh->front.rects);
+	free(sh->data);
+	memset(sh, 0, sizeof(*sh));
+}
+
+static void shadow_copy_rect(struct display_shadow *sh, uint8_t *dst,
+			     const struct uterm_video_rect *r)
+{
+	unsigned int width, height, y;
+	size_t off;
+
+	if (r->x >= sh->stride / sh->bpp || r->y >= sh->height)
+		return;
+
+	width = sh->stride / sh->bpp - r->x;
+	if (r->width < width)
+		width = r->width;
+	height = sh->height - r->y;
+	if (r->height < height)
+		height = r->height;
+
+	for (y = r->y; y < r->y + height; ++y) {
+		off = (size_t)y * sh->stride + r->x * sh->bpp;
+		uterm_stream_copy(&dst[off], &sh->data[off], width * sh->bpp);
+	}
+}
+
+/* more rects than this are not worth tracking, everything is copied then */
+#define DISPLAY_DAMAGE_MAX 1024
+
+/* @rects NULL means the whole buffer is damaged */
+static void damage_add(struct display_damage *d,
+		       const struct uterm_video_rect *rects, size_t num)
+{
+	struct uterm_video_rect *r;
+	size_t size;
+
+	if (d->full)
+		return;
+
+	if (!rects || d->num + num > DISPLAY_DAMAGE_MAX) {
+		d->full = true;
+		return;
+	}
+
+	if (d->num + num > d->size) {
+		size = d->size ? d->size * 2 : 64;
+		if (size < d->num + num)
+			size = d->num + num;
+		r = realloc(d->rects, sizeof(*r) * size);
+		if (!r) {
+			d->full = true;
+			return;
+		}
+		d->rects = r;
+		d->size = size;
+	}
+
+	if (num)
+		memcpy(&d->rects[d->num], rects, sizeof(*rects) * num);
+	d->num += num;
+}
+
+static void damage_reset(struct display_damage *d)
+{
+	d->num = 0;
+	d->full = false;
+}
+
+/*
+ * Copy the damaged regions of the shadow buffer into the scanout buffer @dst.
+ * Everything the back buffer missed from earlier frames is copied, too. If
+ * @dbuf is true, the display alternates between two scanout buffers and @dst
+ * is the back buffer, which is swapped with the front buffer by
+ * display_shadow_swap() once the flip succeeded. If the flip fails, nothing
+ * has to be done, the front buffer still misses the damage of this frame.
+ * @rects and @num have the same meaning as for uterm_display_swap_damage().
+ */
+void display_shadow_flush(struct uterm_display *disp, uint8_t *dst,
+			  bool dbuf, const struct uterm_video_rect *rects,
+			  size_t num)
+{
+	struct display_shadow *sh = &disp->shadow;
+	size_t i;
+
+	if (!rects || sh->back.full) {
+		uterm_stream_copy(dst, sh->data,
+				  (size_t)sh->stride * sh->height);
+	} else {
+		for (i = 0; i < num; ++i)
+			shadow_copy_rect(sh, dst, &rects[i]);
+		for (i = 0; i < sh->back.num; ++i)
+			shadow_copy_rect(sh, dst, &sh->back.rects[i]);
+	}
+	uterm_stream_fence();
+
+	damage_reset(&sh->back);
+	if (dbuf)
+		damage_add(&sh->front, rects, num);
+}
+
+/* the flip after display_shadow_flush() succeeded */
+void display_shadow_swap(struct uterm_display *disp)
+{
+	struct display_shadow *sh = &disp->shadow;
+	struct display_damage tmp;
+
+	tmp = sh->back;
+	sh->back = sh->front;
+	sh->front = tmp;
+}
+
+/* a frame was dropped before it was flushed, so both buffers miss it */
+void display_shadow_drop(struct uterm_display *disp,
+			 const struct uterm_video_rect *rects, size_t num)
+{
+	struct display_shadow *sh = &disp->shadow;
+
+	damage_add(&sh->back, rects, num);
+	damage_add(&sh->front, rects, num);
+}
+
 static void display_vblank_timer_event(struct ev_timer *timer,
 				       uint64_t expirations,
 				       void *data)
@@ -216,6 +368,19 @@ static void display_vblank_timer_event(struct ev_timer *timer,
 	DISPLAY_CB(disp, UTERM_PAGE_FLIP);
 }
 
+static void log_tile_stats(struct uterm_display *disp)
+{
+	struct uterm_tile_stats stats;
+
+	if (!disp->tiles)
+		return;
+
+	uterm_display_get_tile_stats(disp, &stats);
+	log_debug("tile cache of display %p: %lu hits, %lu misses, %lu evictions, "
+		  "%u tiles in %zu bytes", disp, stats.hits, stats.misses,
+		  stats.evictions, stats.num, stats.size);
+}
+
 int display_new(struct uterm_display **out, const struct display_ops *ops)
 {
 	struct uterm_display *disp;
@@ -231,6 +396,7 @@ int display_new(struct uterm_display **out, const struct display_ops *ops)
 	disp->ref = 1;
 	disp->ops = ops;
 	shl_dlist_init(&disp->modes);
+	pthread_mutex_init(&disp->tile_lock, NULL);
 
 	log_info("new display %p", disp);
 
@@ -257,6 +423,7 @@ err_timer:
 err_hook:
 	shl_hook_free(disp->hook);
 err_free:
+	pthread_mutex_destroy(&disp->tile_lock);
 	free(disp);
 	return ret;
 }
@@ -287,6 +454,9 @@ void uterm_display_unref(struct uterm_display *disp)
 	}
 
 	VIDEO_CALL(disp->ops->destroy, 0, disp);
+	log_tile_stats(disp);
+	shl_cache_free(disp->tiles);
+	pthread_mutex_destroy(&disp->tile_lock);
 	ev_timer_unref(disp->vblank_timer);
 	shl_hook_free(disp->hook);
 	free(disp);
@@ -422,6 +592,8 @@ void uterm_display_deactivate(struct uterm_display *disp)
 		return;
 
 	VIDEO_CALL(disp->ops->deactivate, 0, disp);
+	log_tile_stats(disp);
+	shl_cache_clear(disp->tiles);
 }
 
 SHL_EXPORT
@@ -472,6 +644,28 @@ int uterm_display_swap(struct uterm_display *disp, bool immediate)
 	return VIDEO_CALL(disp->ops->swap, 0, disp, immediate);
 }
 
+/*
+ * Like uterm_display_swap() but tells the backend which parts of the
+ * back-buffer changed since the previous swap. Backends that need to copy the
+ * buffer to the output (like USB or virtual devices) can restrict this to the
+ * given regions. If @rects is NULL, the whole buffer is considered damaged. If
+ * @num is 0 but @rects is non-NULL, nothing changed at all.
+ * Backends without damage support simply swap the whole buffer.
+ */
+SHL_EXPORT
+int uterm_display_swap_damage(struct uterm_display *disp, bool immediate,
+			      const struct uterm_video_rect *rects,
+			      size_t num)
+{
+	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
+		return -EINVAL;
+
+	if (!disp->ops->swap_damage)
+		return VIDEO_CALL(disp->ops->swap, 0, disp, immediate);
+
+	return disp->ops->swap_damage(disp, immediate, rects, num);
+}
+
 SHL_EXPORT
 bool uterm_display_is_swapping(struct uterm_display *disp)
 {
@@ -481,6 +675,37 @@ bool uterm_display_is_swapping(struct uterm_display *disp)
 	return disp->vblank_scheduled || (disp->flags & DISPLAY_VSYNC);
 }
 
+/*
+ * Back-buffers of some backends keep their content across swaps. Users can
+ * use this to redraw only the parts of a buffer that changed since it was last
+ * drawn to. Other backends (like EGL surfaces) leave the back-buffer undefined
+ * after a swap so everything must be redrawn each frame.
+ */
+SHL_EXPORT
+bool uterm_display_preserves_buffers(struct uterm_display *disp)
+{
+	if (!disp)
+		return false;
+
+	return disp->flags & DISPLAY_PRESERVE;
+}
+
+/*
+ * Copy the currently displayed front-buffer into @buf. If @buf->data is NULL,
+ * only width, height, stride and format of the front-buffer are stored in @buf
+ * so the caller can allocate a matching buffer. Only the headless backends
+ * support this; the OpenGL one reads the front-buffer back from the GPU.
+ */
+SHL_EXPORT
+int uterm_display_snapshot(struct uterm_display *disp,
+			   struct uterm_video_buffer *buf)
+{
+	if (!disp || !buf || !display_is_online(disp))
+		return -EINVAL;
+
+	return VIDEO_CALL(disp->ops->snapshot, -EOPNOTSUPP, disp, buf);
+}
+
 SHL_EXPORT
 int uterm_display_fill(struct uterm_display *disp,
 		       uint8_t r, uint8_t g, uint8_t b,
@@ -528,6 +753,8 @@ int uterm_display_fake_blend(struct uterm_display *disp,
 	req.bg = bg;
 	req.bb = bb;
 
+	/* tiles of older calls may be evicted from now on */
+	shl_cache_next_frame(disp->tiles);
 	return VIDEO_CALL(disp->ops->fake_blendv, -EOPNOTSUPP, disp, &req, 1);
 }
 
@@ -539,9 +766,189 @@ int uterm_display_fake_blendv(struct uterm_display *disp,
 	if (!disp || !display_is_online(disp) || !video_is_awake(disp->video))
 		return -EINVAL;
 
+	shl_cache_next_frame(disp->tiles);
 	return VIDEO_CALL(disp->ops->fake_blendv, -EOPNOTSUPP, disp, req, num);
 }
 
+/*
+ * Tile Cache
+ * Tiles are looked up by a hash of the glyph-id and both colors. The hash is
+ * not unique, so each tile stores the full key. Of two tiles with the same
+ * hash, only the one that was cached first is kept until it is evicted.
+ * Tiles are never freed during the blend call that found or added them, so
+ * render threads can copy them without holding the lock.
+ */
+
+struct display_tile {
+	uint64_t id;
+	uint32_t fg;
+	uint32_t bg;
+	unsigned int width;
+	unsigned int height;
+	unsigned int bpp;
+	uint8_t data[];
+};
+
+/* the key is only a hash of the identity of a tile */
+static uint64_t tile_key(const struct display_tile *tile)
+{
+	return tile->id * 0x9e3779b97f4a7c15ULL ^
+	       (((uint64_t)tile->fg << 24) | tile->bg);
+}
+
+static uint64_t tile_init(struct display_tile *tile,
+			  const struct uterm_video_blend_req *req,
+			  unsigned int bpp)
+{
+	tile->id = req->id;
+	tile->fg = (req->fr << 16) | (req->fg << 8) | req->fb;
+	tile->bg = (req->br << 16) | (req->bg << 8) | req->bb;
+	tile->width = req->buf->width;
+	tile->height = req->buf->height;
+	tile->bpp = bpp;
+
+	return tile_key(tile);
+}
+
+static bool tile_matches(const void *value, const void *data)
+{
+	const struct display_tile *tile = value, *t = data;
+
+	return tile->id == t->id && tile->fg == t->fg && tile->bg == t->bg &&
+	       tile->width == t->width && tile->height == t->height &&
+	       tile->bpp == t->bpp;
+}
+
+uint8_t *display_tile_find(struct uterm_display *disp,
+			   const struct uterm_video_blend_req *req,
+			   unsigned int bpp)
+{
+	struct display_tile *tile, t;
+	uint64_t key;
+	bool res;
+
+	if (!disp->tiles || !req->id)
+		return NULL;
+
+	key = tile_init(&t, req, bpp);
+	pthread_mutex_lock(&disp->tile_lock);
+	res = shl_cache_find_match(disp->tiles, (void**)&tile, key,
+				   tile_matches, &t);
+	pthread_mutex_unlock(&disp->tile_lock);
+
+	return res ? tile->data : NULL;
+}
+
+uint8_t *display_tile_new(struct uterm_display *disp,
+			  const struct uterm_video_blend_req *req,
+			  unsigned int bpp)
+{
+	struct display_tile *tile;
+	size_t size;
+
+	if (!disp->tiles || !req->id)
+		return NULL;
+
+	size = sizeof(*tile) + (size_t)req->buf->width * req->buf->height * bpp;
+	if (size > disp->tile_budget)
+		return NULL;
+
+	tile = malloc(size);
+	if (!tile)
+		return NULL;
+
+	tile_init(tile, req, bpp);
+	return tile->data;
+}
+
+/* If another thread added the same tile meanwhile, or a different tile with
+ * the same key is cached, @data is dropped. The cached tile may still be in
+ * use by other threads, so it cannot be replaced. */
+void display_tile_add(struct uterm_display *disp, uint8_t *data)
+{
+	struct display_tile *tile;
+	size_t size;
+	int ret;
+
+	if (!data)
+		return;
+
+	tile = (struct display_tile*)(data - offsetof(struct display_tile,
+						      data));
+	size = sizeof(*tile) + (size_t)tile->width * tile->height * tile->bpp;
+
+	pthread_mutex_lock(&disp->tile_lock);
+	ret = shl_cache_insert(disp->tiles, tile_key(tile), tile, size);
+	pthread_mutex_unlock(&disp->tile_lock);
+
+	if (ret)
+		free(tile);
+}
+
+/*
+ * Software backends keep up to @budget bytes of blended glyphs. A budget of 0
+ * disables the cache.
+ */
+SHL_EXPORT
+int uterm_display_set_tile_budget(struct uterm_display *disp, size_t budget)
+{
+	int ret;
+
+	if (!disp)
+		return -EINVAL;
+
+	if (!budget) {
+		shl_cache_free(disp->tiles);
+		disp->tiles = NULL;
+	} else if (!disp->tiles) {
+		ret = shl_cache_new(&disp->tiles, budget, free);
+		if (ret)
+			return ret;
+	} else {
+		shl_cache_set_budget(disp->tiles, budget);
+	}
+
+	disp->tile_budget = budget;
+	return 0;
+}
+
+SHL_EXPORT
+void uterm_display_get_tile_stats(struct uterm_display *disp,
+				  struct uterm_tile_stats *stats)
+{
+	struct shl_cache_stats cs;
+
+	if (!stats)
+		return;
+
+	memset(stats, 0, sizeof(*stats));
+	if (!disp || !disp->tiles)
+		return;
+
+	shl_cache_get_stats(disp->tiles, &cs);
+	stats->hits = cs.hits;
+	stats->misses = cs.misses;
+	stats->evictions = cs.evictions;
+	stats->num = cs.num;
+	stats->size = cs.size;
+	stats->budget = cs.budget;
+}
+
+/*
+ * Expand one row of @width UTERM_FORMAT_MONO pixels at @src into GREY pixels
+ * at @dst. Consumers that can only handle 8bit coverage (like OpenGL alpha
+ * textures) use this when uploading glyphs.
+ */
+SHL_EXPORT
+void uterm_video_unfold_mono(uint8_t *dst, const uint8_t *src,
+			     unsigned int width)
+{
+	unsigned int i;
+
+	for (i = 0; i < width; ++i)
+		dst[i] = -((src[i >> 3] >> (~i & 7)) & 1);
+}
+
 SHL_EXPORT
 int uterm_video_new(struct uterm_video **out, struct ev_eloop *eloop,
 		    const char *node, const struct uterm_video_module *mod)
@@ -610,6 +1017,7 @@ void uterm_video_unref(struct uterm_video *video)
 	}
 
 	VIDEO_CALL(video->ops->destroy, 0, video);
+	render_pool_free(video->pool);
 	shl_hook_free(video->hook);
 	ev_eloop_unref(video->eloop);
 	free(video);
@@ -624,6 +1032,43 @@ void uterm_video_segfault(struct uterm_video *video)
 	VIDEO_CALL(video->ops->segfault, 0, video);
 }
 
+/*
+ * Render into shadow buffers in system memory instead of directly into the
+ * scanout buffers. Only damaged regions are copied to the scanout buffers on
+ * swap. This avoids slow reads and small writes to video memory on backends
+ * that render in software. This only affects displays that are activated
+ * afterwards.
+ */
+SHL_EXPORT
+void uterm_video_set_shadow(struct uterm_video *video, bool shadow)
+{
+	if (!video)
+		return;
+
+	if (shadow)
+		video->flags |= VIDEO_SHADOW;
+	else
+		video->flags &= ~VIDEO_SHADOW;
+}
+
+/*
+ * Software backends split rendering into horizontal bands which @num threads
+ * draw in parallel, including the event-loop thread. 0 uses one thread per CPU
+ * and 1 disables parallel rendering. This must be called before the first
+ * frame is drawn.
+ */
+SHL_EXPORT
+void uterm_video_set_render_threads(struct uterm_video *video,
+				    unsigned int num)
+{
+	if (!video || video->pool)
+		return;
+
+	if (num > DISPLAY_MAX_BANDS)
+		num = DISPLAY_MAX_BANDS;
+	video->render_threads = num;
+}
+
 SHL_EXPORT
 struct uterm_display *uterm_video_get_displays(struct uterm_video *video)
 {
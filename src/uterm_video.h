@@ -96,11 +96,18 @@ struct uterm_display_event {
 	int action;
 };
 
+/*
+ * UTERM_FORMAT_MONO stores 1 bit per pixel with the leftmost pixel in the most
+ * significant bit. The stride is in bytes. Set bits select the foreground
+ * color when blending, so bitmap fonts need neither expansion nor
+ * multiplications.
+ */
 enum uterm_video_format {
 	UTERM_FORMAT_GREY	= 0x01,
 	UTERM_FORMAT_XRGB32	= 0x02,
 	UTERM_FORMAT_RGB16	= 0x04,
 	UTERM_FORMAT_RGB24	= 0x08,
+	UTERM_FORMAT_MONO	= 0x10,
 };
 
 struct uterm_video_buffer {
@@ -111,8 +118,23 @@ struct uterm_video_buffer {
 	uint8_t *data;
 };
 
+struct uterm_video_rect {
+	unsigned int x;
+	unsigned int y;
+	unsigned int width;
+	unsigned int height;
+};
+
+/*
+ * @id identifies the content of @buf, 0 if it is unknown. Software backends
+ * cache the blended result of requests with an @id per color pair and the 3D
+ * backend keeps them in its glyph atlas, so two requests with the same
+ * non-zero @id must always have identical buffers. Buffer addresses are no
+ * identity, as fonts may free and reuse glyph buffers.
+ */
 struct uterm_video_blend_req {
 	const struct uterm_video_buffer *buf;
+	uint64_t id;
 	unsigned int x;
 	unsigned int y;
 	uint8_t fr;
@@ -123,6 +145,15 @@ struct uterm_video_blend_req {
 	uint8_t bb;
 };
 
+struct uterm_tile_stats {
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	unsigned int num;		/* number of cached tiles */
+	size_t size;			/* bytes used by them */
+	size_t budget;			/* 0 if the cache is disabled */
+};
+
 typedef void (*uterm_video_cb) (struct uterm_video *video,
 				struct uterm_video_hotplug *arg,
 				void *data);
@@ -171,7 +202,13 @@ int uterm_display_get_buffers(struct uterm_display *disp,
 			      struct uterm_video_buffer *buffer,
 			      unsigned int formats);
 int uterm_display_swap(struct uterm_display *disp, bool immediate);
+int uterm_display_swap_damage(struct uterm_display *disp, bool immediate,
+			      const struct uterm_video_rect *rects,
+			      size_t num);
 bool uterm_display_is_swapping(struct uterm_display *disp);
+bool uterm_display_preserves_buffers(struct uterm_display *disp);
+int uterm_display_snapshot(struct uterm_display *disp,
+			   struct uterm_video_buffer *buf);
 
 int uterm_display_fill(struct uterm_display *disp,
 		       uint8_t r, uint8_t g, uint8_t b,
@@ -188,6 +225,12 @@ int uterm_display_fake_blend(struct uterm_display *disp,
 int uterm_display_fake_blendv(struct uterm_display *disp,
 			      const struct uterm_video_blend_req *req,
 			      size_t num);
+int uterm_display_set_tile_budget(struct uterm_display *disp, size_t budget);
+void uterm_display_get_tile_stats(struct uterm_display *disp,
+				  struct uterm_tile_stats *stats);
+
+void uterm_video_unfold_mono(uint8_t *dst, const uint8_t *src,
+			     unsigned int width);
 
 /* video interface */
 
@@ -197,6 +240,9 @@ void uterm_video_ref(struct uterm_video *video);
 void uterm_video_unref(struct uterm_video *video);
 
 void uterm_video_segfault(struct uterm_video *video);
+void uterm_video_set_shadow(struct uterm_video *video, bool shadow);
+void uterm_video_set_render_threads(struct uterm_video *video,
+				    unsigned int num);
 struct uterm_display *uterm_video_get_displays(struct uterm_video *video);
 int uterm_video_register_cb(struct uterm_video *video, uterm_video_cb cb,
 			    void *data);
@@ -228,4 +274,16 @@ extern const struct uterm_video_module *UTERM_VIDEO_DRM3D;
 #define UTERM_VIDEO_DRM3D NULL
 #endif
 
+#ifdef BUILD_ENABLE_VIDEO_HEADLESS
+extern const struct uterm_video_module *UTERM_VIDEO_HEADLESS;
+#else
+#define UTERM_VIDEO_HEADLESS NULL
+#endif
+
+#ifdef BUILD_ENABLE_VIDEO_HEADLESS_GL
+extern const struct uterm_video_module *UTERM_VIDEO_HEADLESS_GL;
+#else
+#define UTERM_VIDEO_HEADLESS_GL NULL
+#endif
+
 #endif /* UTERM_UTERM_VIDEO_H */
@@ -30,9 +30,12 @@
 
 #include <inttypes.h>
 #include <limits.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include "eloop.h"
+#include "shl_cache.h"
 #include "shl_dlist.h"
 #include "shl_hook.h"
 #include "uterm_video.h"
@@ -58,6 +61,10 @@ struct display_ops {
 			    struct uterm_video_buffer *buffer,
 			    unsigned int formats);
 	int (*swap) (struct uterm_display *disp, bool immediate);
+	int (*swap_damage) (struct uterm_display *disp, bool immediate,
+			    const struct uterm_video_rect *rects, size_t num);
+	int (*snapshot) (struct uterm_display *disp,
+			 struct uterm_video_buffer *buf);
 	int (*blit) (struct uterm_display *disp,
 		     const struct uterm_video_buffer *buf,
 		     unsigned int x, unsigned int y);
@@ -108,6 +115,36 @@ void uterm_mode_unbind(struct uterm_mode *mode);
 #define DISPLAY_DBUF		0x10
 #define DISPLAY_DITHERING	0x20
 #define DISPLAY_PFLIP		0x40
+#define DISPLAY_PRESERVE	0x80
+
+/* maximum number of bands a display is split into for software rendering */
+#define DISPLAY_MAX_BANDS 16
+
+/*
+ * Shadow buffers are kept in cached system memory and use the same layout as
+ * the scanout buffers of a display. Backends render into them and copy only
+ * the damaged parts to the scanout buffer on swap.
+ * With double-buffering, the damage each of both scanout buffers misses is
+ * tracked separately, as flips may fail or frames may be dropped before they
+ * are flushed. Then the front buffer misses damage, too.
+ */
+struct display_damage {
+	struct uterm_video_rect *rects;
+	size_t num;
+	size_t size;
+	bool full;
+};
+
+struct display_shadow {
+	uint8_t *data;
+	unsigned int stride;
+	unsigned int height;
+	unsigned int bpp;
+
+	/* damage missed by the back and front buffer */
+	struct display_damage back;
+	struct display_damage front;
+};
 
 struct uterm_display {
 	struct shl_dlist list;
@@ -125,6 +162,12 @@ struct uterm_display {
 	struct itimerspec vblank_spec;
 	struct ev_timer *vblank_timer;
 
+	struct display_shadow shadow;
+	/* shared by all render threads, protected by @tile_lock */
+	pthread_mutex_t tile_lock;
+	struct shl_cache *tiles;
+	size_t tile_budget;
+
 	const struct display_ops *ops;
 	void *data;
 };
@@ -146,10 +189,94 @@ static inline bool display_is_online(const struct uterm_display *disp)
 	return disp->video && (disp->flags & DISPLAY_ONLINE);
 }
 
+int display_shadow_init(struct uterm_display *disp, unsigned int stride,
+			unsigned int height, unsigned int bpp);
+void display_shadow_destroy(struct uterm_display *disp);
+void display_shadow_flush(struct uterm_display *disp, uint8_t *dst,
+			  bool dbuf, const struct uterm_video_rect *rects,
+			  size_t num);
+void display_shadow_swap(struct uterm_display *disp);
+void display_shadow_drop(struct uterm_display *disp,
+			 const struct uterm_video_rect *rects, size_t num);
+
+static inline bool display_has_shadow(const struct uterm_display *disp)
+{
+	return disp->shadow.data;
+}
+
+/*
+ * The tile cache keeps blended glyphs in the format of the framebuffer so
+ * drawing a glyph again with the same colors is a plain copy. Tiles are
+ * @bpp * width bytes wide without padding. Found tiles stay valid until the
+ * current blend call returns, so all render threads share the cache.
+ * New tiles are allocated with display_tile_new(), drawn by the caller and
+ * then handed over with display_tile_add(), so other threads never see a
+ * tile that is only partially drawn. The cache is cleared when the display is
+ * deactivated, as its format may change with the next mode.
+ */
+uint8_t *display_tile_find(struct uterm_display *disp,
+			   const struct uterm_video_blend_req *req,
+			   unsigned int bpp);
+uint8_t *display_tile_new(struct uterm_display *disp,
+			  const struct uterm_video_blend_req *req,
+			  unsigned int bpp);
+void display_tile_add(struct uterm_display *disp, uint8_t *tile);
+
+static inline void display_tile_copy(uint8_t *dst, unsigned int dst_stride,
+				     const uint8_t *tile, unsigned int len,
+				     unsigned int height)
+{
+	while (height--) {
+		memcpy(dst, tile, len);
+		dst += dst_stride;
+		tile += len;
+	}
+}
+
+/*
+ * Software backends draw the blend requests of each of @bands horizontal bands
+ * of a @height pixels high screen in parallel. @cb draws all requests of @req
+ * that start in @band, see display_in_band(). Requests must not overlap. Once
+ * display_render_bands() returns, all bands are drawn. Unless @parallel is
+ * set, or if the screen or @num are small, @cb is called once for a single
+ * band on the calling thread.
+ */
+typedef int (*display_band_cb) (struct uterm_display *disp,
+				const struct uterm_video_blend_req *req,
+				size_t num, unsigned int height,
+				unsigned int band, unsigned int bands);
+
+int display_render_bands(struct uterm_display *disp,
+			 const struct uterm_video_blend_req *req, size_t num,
+			 unsigned int height, bool parallel,
+			 display_band_cb cb);
+
+/* requests below the screen belong to the last band, which rejects them */
+static inline bool display_in_band(const struct uterm_video_blend_req *req,
+				   unsigned int height, unsigned int band,
+				   unsigned int bands)
+{
+	uint64_t b;
+
+	if (bands < 2)
+		return true;
+
+	b = (uint64_t)req->y * bands / height;
+	if (b >= bands)
+		b = bands - 1;
+	return b == band;
+}
+
 /* uterm_video */
 
+struct render_pool;
+
+void render_pool_free(struct render_pool *pool);
+unsigned int render_pool_get_threads(struct uterm_video *video);
+
 #define VIDEO_AWAKE		0x01
 #define VIDEO_HOTPLUG		0x02
+#define VIDEO_SHADOW		0x04
 
 struct uterm_video {
 	unsigned long ref;
@@ -162,6 +289,10 @@ struct uterm_video {
 	const struct uterm_video_module *mod;
 	const struct video_ops *ops;
 	void *data;
+
+	/* threads for software rendering, 0 until chosen */
+	unsigned int render_threads;
+	struct render_pool *pool;
 };
 
 static inline bool video_is_awake(const struct uterm_video *video)
@@ -174,6 +305,11 @@ static inline bool video_need_hotplug(const struct uterm_video *video)
 	return video->flags & VIDEO_HOTPLUG;
 }
 
+static inline bool video_use_shadow(const struct uterm_video *video)
+{
+	return video->flags & VIDEO_SHADOW;
+}
+
 #define VIDEO_CB(vid, disp, act) shl_hook_call((vid)->hook, (vid), \
 		&(struct uterm_video_hotplug){ \
 			.display = (disp), \
@@ -0,0 +1,705 @@
+/*
+ * bench_terminal - Terminal throughput benchmark
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Terminal Throughput Benchmark
+ * This replays terminal output through the same pipeline kmscon uses:
+ * tsm_vte_input() -> tsm_screen_draw() -> kmscon_text -> uterm_display. The
+ * output goes to a headless display so no device is needed. gltex runs on the
+ * headless GL backend instead, which renders through surfaceless EGL. Without
+ * a GPU that is a software stack like llvmpipe, so compare its numbers with
+ * care.
+ *
+ * The streams are generated with a fixed seed so every run sees the same
+ * bytes:
+ *  - log: cat of a large plain-text log file
+ *  - htop: full-screen repaints with cursor positioning and colors
+ *  - scroll: scrolling inside a scroll-region like an editor or pager
+ *  - cjk: wide CJK and Hangul text
+ *
+ * The input is fed in chunks like reads from a pty. A frame is drawn after
+ * each chunk. For each text backend, font backend and stream this prints the
+ * parser throughput, the frame rate and the 50th and 99th percentile of the
+ * time spent drawing a single frame.
+ */
+
+static void print_help();
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <libtsm.h>
+#include "eloop.h"
+#include "font.h"
+#include "shl_log.h"
+#include "text.h"
+#include "uterm_video.h"
+#include "test_include.h"
+
+#define BENCH_CHUNK 4096
+
+struct {
+	char *mode;
+	char *text;
+	char *font;
+	unsigned int size;
+} bench_conf;
+
+struct bench_buf {
+	char *data;
+	size_t len;
+	size_t size;
+};
+
+struct bench_stream {
+	const char *name;
+	void (*gen) (struct bench_buf *buf, unsigned int cols,
+		     unsigned int rows, size_t size);
+};
+
+struct bench_result {
+	size_t bytes;
+	uint64_t parse_ns;
+	uint64_t total_ns;
+	uint64_t *frames;
+	size_t num_frames;
+	size_t size_frames;
+};
+
+static uint32_t bench_seed;
+
+static uint32_t bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return bench_seed >> 16;
+}
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench_printf(struct bench_buf *buf, const char *format, ...)
+{
+	va_list args;
+	size_t size;
+	char *data;
+	int len;
+
+	while (true) {
+		va_start(args, format);
+		len = vsnprintf(&buf->data[buf->len], buf->size - buf->len,
+				format, args);
+		va_end(args);
+
+		if (len < 0)
+			return;
+		if ((size_t)len < buf->size - buf->len)
+			break;
+
+		size = buf->size * 2 + len + 1;
+		data = realloc(buf->data, size);
+		if (!data)
+			return;
+		buf->data = data;
+		buf->size = size;
+	}
+
+	buf->len += len;
+}
+
+static void bench_utf8(struct bench_buf *buf, uint32_t ch)
+{
+	if (ch < 0x80)
+		bench_printf(buf, "%c", ch);
+	else if (ch < 0x800)
+		bench_printf(buf, "%c%c", 0xc0 | (ch >> 6),
+			     0x80 | (ch & 0x3f));
+	else
+		bench_printf(buf, "%c%c%c", 0xe0 | (ch >> 12),
+			     0x80 | ((ch >> 6) & 0x3f), 0x80 | (ch & 0x3f));
+}
+
+static void gen_log(struct bench_buf *buf, unsigned int cols,
+		    unsigned int rows, size_t size)
+{
+	static const char *msgs[] = {
+		"request completed",
+		"connection reset by peer, retrying",
+		"cache miss for key",
+		"scheduled job finished without errors",
+	};
+	unsigned int i = 0;
+
+	while (buf->len < size) {
+		bench_printf(buf, "2013-03-%02u 12:%02u:%02u.%06u host app[%u]: %s %08x in %u us\r\n",
+			     1 + i / 100000 % 28, i / 6000 % 60, i / 100 % 60,
+			     bench_rand() % 1000000, 1000 + bench_rand() % 64,
+			     msgs[bench_rand() % 4], bench_rand(),
+			     bench_rand() % 5000);
+		++i;
+	}
+}
+
+static void gen_htop(struct bench_buf *buf, unsigned int cols,
+		     unsigned int rows, size_t size)
+{
+	unsigned int i, row, bar, width, frame = 0;
+
+	width = cols > 20 ? cols / 2 - 10 : 1;
+
+	while (buf->len < size) {
+		bench_printf(buf, "\033[?25l\033[H");
+		for (i = 0; i < 4 && i < rows; ++i) {
+			bar = bench_rand() % (width + 1);
+			bench_printf(buf, "\033[%u;1H  %u\033[1m[\033[0;32m%.*s\033[31m%.*s\033[0m%*s\033[1m%3u%%]\033[0m\033[K",
+				     i + 1, i, bar / 2,
+				     "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||",
+				     bar - bar / 2,
+				     "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||",
+				     width - bar, "", bar * 100 / width);
+		}
+
+		if (rows > 6)
+			bench_printf(buf, "\033[6;1H\033[30;42m  PID USER      PRI  NI  VIRT   RES   SHR S CPU%% MEM%%   TIME+  Command\033[K\033[0m");
+
+		for (row = 7; row < rows; ++row) {
+			if (row == 7 + frame % (rows - 7))
+				bench_printf(buf, "\033[%u;1H\033[30;46m", row);
+			else
+				bench_printf(buf, "\033[%u;1H\033[0m", row);
+			bench_printf(buf, "%5u user       20   0 %4uM %4uM %4uM %c %4.1f %4.1f %2u:%02u.%02u \033[1m/usr/bin/proc%u\033[0m\033[K",
+				     1000 + row * 7, bench_rand() % 4096,
+				     bench_rand() % 1024, bench_rand() % 256,
+				     bench_rand() % 5 ? 'S' : 'R',
+				     (bench_rand() % 1000) / 10.0,
+				     (bench_rand() % 1000) / 10.0,
+				     frame / 3600 % 60, frame / 60 % 60,
+				     frame % 60, row);
+		}
+
+		bench_printf(buf, "\033[%u;1H\033[0mF1\033[30;46mHelp  \033[0mF2\033[30;46mSetup \033[0mF3\033[30;46mSearch\033[0mF9\033[30;46mKill  \033[0mF10\033[30;46mQuit\033[K\033[0m",
+			     rows);
+		++frame;
+	}
+}
+
+static void gen_scroll(struct bench_buf *buf, unsigned int cols,
+		       unsigned int rows, size_t size)
+{
+	unsigned int i = 0, j, len;
+
+	if (rows < 4) {
+		gen_log(buf, cols, rows, size);
+		return;
+	}
+
+	bench_printf(buf, "\033[2J\033[2;%ur", rows - 1);
+
+	while (buf->len < size) {
+		if (bench_rand() % 8) {
+			/* scroll up by printing at the bottom of the region */
+			bench_printf(buf, "\033[%u;1H\n", rows - 1);
+		} else {
+			/* scroll down via reverse-index */
+			bench_printf(buf, "\033[2;1H\033M");
+		}
+
+		len = bench_rand() % (cols + 1);
+		bench_printf(buf, "\033[3%um%5u \033[0m", 1 + i % 7, i);
+		for (j = 6; j < len; ++j)
+			bench_printf(buf, "%c", 'a' + bench_rand() % 26);
+		bench_printf(buf, "\033[K");
+
+		bench_printf(buf, "\0337\033[1;1H\033[7m file.c  line %u \033[K\033[0m\033[%u;1H\033[7m -- INSERT -- \033[K\033[0m\0338",
+			     i, rows);
+		++i;
+	}
+
+	bench_printf(buf, "\033[r");
+}
+
+static void gen_cjk(struct bench_buf *buf, unsigned int cols,
+		    unsigned int rows, size_t size)
+{
+	unsigned int pos;
+	uint32_t ch;
+
+	while (buf->len < size) {
+		pos = 0;
+		while (pos + 2 < cols) {
+			switch (bench_rand() % 6) {
+			case 0:
+				bench_printf(buf, " abc ");
+				pos += 5;
+				continue;
+			case 1:
+				ch = 0xac00 + bench_rand() % 1024;
+				break;
+			case 2:
+				ch = 0x3041 + bench_rand() % 86;
+				break;
+			default:
+				ch = 0x4e00 + bench_rand() % 2048;
+				break;
+			}
+			bench_utf8(buf, ch);
+			pos += 2;
+		}
+		bench_printf(buf, "\r\n");
+	}
+}
+
+static const struct bench_stream streams[] = {
+	{ "log", gen_log },
+	{ "htop", gen_htop },
+	{ "scroll", gen_scroll },
+	{ "cjk", gen_cjk },
+};
+
+static void write_event(struct tsm_vte *vte, const char *u8, size_t len,
+			void *data)
+{
+	/* answers to queries are dropped */
+}
+
+static int draw_frame(struct uterm_display *disp, struct kmscon_text *txt,
+		      struct tsm_screen *screen, tsm_age_t *ages)
+{
+	const struct uterm_video_rect *rects = NULL;
+	tsm_age_t age = 0;
+	size_t num = 0;
+	int ret, buf;
+
+	buf = uterm_display_use(disp, NULL);
+	if (buf >= 0 && buf < 2 && uterm_display_preserves_buffers(disp))
+		age = ages[buf];
+	else
+		buf = -1;
+
+	ret = kmscon_text_prepare(txt, age);
+	age = tsm_screen_draw(screen, kmscon_text_draw_cb, txt);
+	if (!ret)
+		ret = kmscon_text_render(txt);
+	if (!ret)
+		kmscon_text_get_damage(txt, &rects, &num);
+	if (buf >= 0)
+		ages[buf] = ret ? 0 : age;
+	if (ret)
+		return ret;
+
+	return uterm_display_swap_damage(disp, true, rects, num);
+}
+
+static int add_frame(struct bench_result *res, uint64_t ns)
+{
+	uint64_t *frames;
+	size_t size;
+
+	if (res->num_frames >= res->size_frames) {
+		size = res->size_frames ? res->size_frames * 2 : 1024;
+		frames = realloc(res->frames, sizeof(*frames) * size);
+		if (!frames)
+			return -ENOMEM;
+		res->frames = frames;
+		res->size_frames = size;
+	}
+
+	res->frames[res->num_frames++] = ns;
+	return 0;
+}
+
+static int run_stream(struct uterm_display *disp, struct kmscon_text *txt,
+		      struct tsm_screen *screen, struct tsm_vte *vte,
+		      const struct bench_buf *buf, struct bench_result *res)
+{
+	tsm_age_t ages[2] = { 0, 0 };
+	uint64_t start, parsed, drawn;
+	size_t pos, len;
+	int ret;
+
+	tsm_vte_hard_reset(vte);
+	start = bench_now();
+
+	for (pos = 0; pos < buf->len; pos += len) {
+		len = buf->len - pos;
+		if (len > BENCH_CHUNK)
+			len = BENCH_CHUNK;
+
+		parsed = bench_now();
+		tsm_vte_input(vte, &buf->data[pos], len);
+		drawn = bench_now();
+		res->parse_ns += drawn - parsed;
+
+		ret = draw_frame(disp, txt, screen, ages);
+		if (ret)
+			return ret;
+
+		ret = add_frame(res, bench_now() - drawn);
+		if (ret)
+			return ret;
+	}
+
+	res->total_ns = bench_now() - start;
+	res->bytes = buf->len;
+	return 0;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	const uint64_t *x = a, *y = b;
+
+	return *x < *y ? -1 : *x > *y;
+}
+
+static void print_result(const char *text, const char *font,
+			 const char *stream, struct bench_result *res)
+{
+	double mbs = 0, fps = 0, p50 = 0, p99 = 0;
+
+	if (res->parse_ns)
+		mbs = res->bytes * 1000.0 / res->parse_ns;
+	if (res->total_ns)
+		fps = res->num_frames * 1000000000.0 / res->total_ns;
+	if (res->num_frames) {
+		qsort(res->frames, res->num_frames, sizeof(*res->frames),
+		      cmp_u64);
+		p50 = res->frames[res->num_frames * 50 / 100] / 1000000.0;
+		p99 = res->frames[res->num_frames * 99 / 100] / 1000000.0;
+	}
+
+	printf("%-8s %-8s %-8s %9.2f MB/s %9.1f fps  p50 %8.3f ms  p99 %8.3f ms\n",
+	       text, font, stream, mbs, fps, p50, p99);
+	fflush(stdout);
+}
+
+static int run_backends(struct uterm_display *disp, const char *text,
+			const char *font_name)
+{
+	struct kmscon_font_attr attr;
+	struct kmscon_font *font, *bold_font;
+	struct kmscon_text *txt;
+	struct tsm_screen *screen;
+	struct tsm_vte *vte;
+	struct bench_buf buf;
+	struct bench_result res;
+	unsigned int i, cols, rows;
+	int ret;
+
+	memset(&attr, 0, sizeof(attr));
+	strncpy(attr.name, KMSCON_FONT_DEFAULT_NAME, KMSCON_FONT_MAX_NAME - 1);
+	attr.ppi = 96;
+	attr.points = 12;
+
+	ret = kmscon_font_find(&font, &attr, font_name);
+	if (ret || strcmp(font->ops->name, font_name)) {
+		if (!ret)
+			kmscon_font_unref(font);
+		printf("%-8s %-8s font backend not available, skipped\n",
+		       text, font_name);
+		return 0;
+	}
+
+	attr.bold = true;
+	ret = kmscon_font_find(&bold_font, &attr, font_name);
+	if (ret) {
+		bold_font = font;
+		kmscon_font_ref(bold_font);
+	}
+
+	ret = kmscon_text_new(&txt, text, "normal");
+	if (ret)
+		goto err_font;
+	if (strcmp(txt->ops->name, text)) {
+		printf("%-8s %-8s text backend not available, skipped\n",
+		       text, font_name);
+		goto err_text;
+	}
+
+	ret = kmscon_text_set(txt, font, bold_font, disp);
+	if (ret) {
+		log_error("cannot set text-renderer %s: %d", text, ret);
+		goto err_text;
+	}
+
+	cols = kmscon_text_get_cols(txt);
+	rows = kmscon_text_get_rows(txt);
+
+	ret = tsm_screen_new(&screen, log_llog, NULL);
+	if (ret)
+		goto err_text;
+
+	ret = tsm_screen_resize(screen, cols, rows);
+	if (ret)
+		goto err_screen;
+
+	ret = tsm_vte_new(&vte, screen, write_event, NULL, log_llog, NULL);
+	if (ret)
+		goto err_screen;
+
+	for (i = 0; i < sizeof(streams) / sizeof(*streams); ++i) {
+		memset(&res, 0, sizeof(res));
+		memset(&buf, 0, sizeof(buf));
+		buf.size = bench_conf.size * 1024 + BENCH_CHUNK;
+		buf.data = malloc(buf.size);
+		if (!buf.data) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		bench_seed = 1;
+		streams[i].gen(&buf, cols, rows, bench_conf.size * 1024);
+
+		ret = run_stream(disp, txt, screen, vte, &buf, &res);
+		if (ret)
+			log_error("cannot replay stream %s: %d",
+				  streams[i].name, ret);
+		else
+			print_result(text, font_name, streams[i].name, &res);
+
+		free(res.frames);
+		free(buf.data);
+		if (ret)
+			break;
+	}
+
+	tsm_vte_unref(vte);
+err_screen:
+	tsm_screen_unref(screen);
+err_text:
+	kmscon_text_unref(txt);
+err_font:
+	kmscon_font_unref(bold_font);
+	kmscon_font_unref(font);
+	return ret;
+}
+
+static void print_help()
+{
+	/*
+	 * Usage/Help information
+	 * This should be scaled to a maximum of 80 characters per line:
+	 *
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+	fprintf(stderr,
+		"Usage:\n"
+		"\t%1$s [options]\n"
+		"\t%1$s -h [options]\n"
+		"\n"
+		"You can prefix boolean options with \"no-\" to negate it. If an argument is\n"
+		"given multiple times, only the last argument matters if not otherwise stated.\n"
+		"\n"
+		"General Options:\n"
+		TEST_HELP
+		"\n"
+		"Benchmark Options:\n"
+		"\t    --mode <mode>           [1280x800]  Size of the headless display\n"
+		"\t    --text <backend>        [all]   Only run the given text backend\n"
+		"\t    --font <backend>        [all]   Only run the given font backend\n"
+		"\t    --size <KiB>            [1024]  Size of each stream\n",
+		"bench_terminal");
+	/*
+	 * 80 char line:
+	 *       |   10   |    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "12345678901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 * 80 char line starting with tab:
+	 *       |10|    20   |    30   |    40   |    50   |    60   |    70   |    80   |
+	 *      "\t901234567890123456789012345678901234567890123456789012345678901234567890\n"
+	 */
+}
+
+struct conf_option options[] = {
+	TEST_OPTIONS,
+	CONF_OPTION_STRING(0, "mode", &bench_conf.mode, "1280x800"),
+	CONF_OPTION_STRING(0, "text", &bench_conf.text, NULL),
+	CONF_OPTION_STRING(0, "font", &bench_conf.font, NULL),
+	CONF_OPTION_UINT(0, "size", &bench_conf.size, 1024),
+};
+
+static const char *texts[] = {
+	"bblit",
+	"bbulk",
+	"pixman",
+	"gltex",
+	NULL,
+};
+
+static const char *fonts[] = {
+	"8x16",
+	"unifont",
+	"pango",
+	NULL,
+};
+
+static int open_display(struct ev_eloop *eloop,
+			const struct uterm_video_module *mod,
+			struct uterm_video **out, struct uterm_display **disp)
+{
+	struct uterm_video *video;
+	int ret;
+
+	ret = uterm_video_new(&video, eloop, bench_conf.mode, mod);
+	if (ret)
+		return ret;
+
+	/* the headless display is announced from an idle callback */
+	ret = ev_eloop_dispatch(eloop, 0);
+	if (ret)
+		goto err_unref;
+
+	ret = uterm_video_wake_up(video);
+	if (ret)
+		goto err_unref;
+
+	*disp = uterm_video_get_displays(video);
+	if (!*disp) {
+		ret = -ENODEV;
+		goto err_unref;
+	}
+
+	ret = uterm_display_activate(*disp, NULL);
+	if (ret)
+		goto err_unref;
+
+	*out = video;
+	return 0;
+
+err_unref:
+	uterm_video_unref(video);
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	struct ev_eloop *eloop;
+	struct uterm_video *video, *gl_video = NULL;
+	struct uterm_display *disp, *gl_disp = NULL, *d;
+	unsigned int i, j;
+	size_t onum;
+	int ret;
+
+	onum = sizeof(options) / sizeof(*options);
+	ret = test_prepare(options, onum, argc, argv, &eloop);
+	if (ret)
+		goto err_fail;
+
+	kmscon_font_register(&kmscon_font_8x16_ops);
+#ifdef BUILD_ENABLE_FONT_UNIFONT
+	kmscon_font_register(&kmscon_font_unifont_ops);
+#endif
+#ifdef BUILD_ENABLE_FONT_PANGO
+	kmscon_font_register(&kmscon_font_pango_ops);
+#endif
+	kmscon_text_register(&kmscon_text_bblit_ops);
+#ifdef BUILD_ENABLE_RENDERER_BBULK
+	kmscon_text_register(&kmscon_text_bbulk_ops);
+#endif
+#ifdef BUILD_ENABLE_RENDERER_PIXMAN
+	kmscon_text_register(&kmscon_text_pixman_ops);
+#endif
+#if defined(BUILD_ENABLE_RENDERER_GLTEX) && defined(BUILD_ENABLE_VIDEO_HEADLESS_GL)
+	kmscon_text_register(&kmscon_text_gltex_ops);
+#endif
+
+	ret = open_display(eloop, UTERM_VIDEO_HEADLESS, &video, &disp);
+	if (ret)
+		goto err_exit;
+
+	/* gltex needs an OpenGL display, missing support only skips it */
+	if (!bench_conf.text || !strcmp(bench_conf.text, "gltex")) {
+		ret = open_display(eloop, UTERM_VIDEO_HEADLESS_GL, &gl_video,
+				   &gl_disp);
+		if (ret)
+			log_warning("cannot open headless GL display: %d", ret);
+		ret = 0;
+	}
+
+	printf("%-8s %-8s %-8s %14s %13s  %11s  %11s\n", "text", "font",
+	       "stream", "parse", "frames", "frame", "frame");
+
+	for (i = 0; texts[i]; ++i) {
+		if (bench_conf.text && strcmp(bench_conf.text, texts[i]))
+			continue;
+
+		d = disp;
+		if (!strcmp(texts[i], "gltex")) {
+			if (!gl_video) {
+				printf("%-8s %-8s headless GL backend not available, skipped\n",
+				       texts[i], "*");
+				continue;
+			}
+			d = gl_disp;
+		}
+
+		for (j = 0; fonts[j]; ++j) {
+			if (bench_conf.font && strcmp(bench_conf.font, fonts[j]))
+				continue;
+
+			ret = run_backends(d, texts[i], fonts[j]);
+			if (ret)
+				goto err_unref;
+		}
+	}
+
+err_unref:
+	uterm_video_unref(gl_video);
+	uterm_video_unref(video);
+err_exit:
+#if defined(BUILD_ENABLE_RENDERER_GLTEX) && defined(BUILD_ENABLE_VIDEO_HEADLESS_GL)
+	kmscon_text_unregister(kmscon_text_gltex_ops.name);
+#endif
+#ifdef BUILD_ENABLE_RENDERER_PIXMAN
+	kmscon_text_unregister(kmscon_text_pixman_ops.name);
+#endif
+#ifdef BUILD_ENABLE_RENDERER_BBULK
+	kmscon_text_unregister(kmscon_text_bbulk_ops.name);
+#endif
+	kmscon_text_unregister(kmscon_text_bblit_ops.name);
+#ifdef BUILD_ENABLE_FONT_PANGO
+	kmscon_font_unregister(kmscon_font_pango_ops.name);
+#endif
+#ifdef BUILD_ENABLE_FONT_UNIFONT
+	kmscon_font_unregister(kmscon_font_unifont_ops.name);
+#endif
+	kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	test_exit(options, onum, eloop);
+err_fail:
+	if (ret != -ECANCELED)
+		test_fail(ret);
+	return abs(ret);
+}
@@ -0,0 +1,172 @@
+/*
+ * test_blend - Test software blending kernels
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * The SIMD blending kernels must produce exactly the same output as the
+ * scalar reference implementation. Kernels that are not supported on the
+ * machine running the test are skipped. The 1bpp kernels must match the
+ * reference applied to the same bitmap expanded to 0x00 and 0xff.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "test_common.h"
+#include "uterm_blend.h"
+
+#define SRC_WIDTH 64
+#define SRC_HEIGHT 20
+#define DST_STRIDE (SRC_WIDTH * 4 + 12)
+
+static uint8_t src[SRC_WIDTH * SRC_HEIGHT];
+static uint8_t ref[DST_STRIDE * SRC_HEIGHT];
+static uint8_t out[DST_STRIDE * SRC_HEIGHT];
+static uint8_t mono[SRC_WIDTH / 8 * SRC_HEIGHT];
+
+static void fill_src(void)
+{
+	unsigned int i;
+
+	/* every alpha value once, then pseudo-random data */
+	for (i = 0; i < 256; ++i)
+		src[i] = i;
+	for ( ; i < sizeof(src); ++i)
+		src[i] = (i * 131 + 7) ^ (i >> 3);
+}
+
+static void compare_impl(unsigned int impl, unsigned int width,
+			 unsigned int height, uint32_t fg, uint32_t bg)
+{
+	uterm_blend_t ref_fn, fn;
+
+	ref_fn = uterm_blend_get(UTERM_BLEND_SCALAR);
+	fn = uterm_blend_get(impl);
+
+	memset(ref, 0xaa, sizeof(ref));
+	memset(out, 0xaa, sizeof(out));
+
+	ref_fn(ref, DST_STRIDE, src, SRC_WIDTH, width, height, fg, bg);
+	fn(out, DST_STRIDE, src, SRC_WIDTH, width, height, fg, bg);
+
+	ck_assert_mem_eq(ref, out, sizeof(ref));
+}
+
+START_TEST(test_blend_reference)
+{
+	uterm_blend_t fn;
+	uint32_t px[3];
+	uint8_t a[3] = { 0, 128, 255 };
+
+	fn = uterm_blend_get(UTERM_BLEND_SCALAR);
+	ck_assert_ptr_ne(fn, NULL);
+
+	fn((uint8_t*)px, sizeof(px), a, sizeof(a), 3, 1,
+	   0xffff8000, 0x00000010);
+	ck_assert_uint_eq(px[0], 0x000010);
+	ck_assert_uint_eq(px[1], 0x804008);
+	ck_assert_uint_eq(px[2], 0xff8000);
+}
+END_TEST
+
+START_TEST(test_blend_simd)
+{
+	unsigned int impl, i, j, w, h, tested = 0;
+	uint32_t fg, bg;
+
+	fill_src();
+	ck_assert_ptr_ne(uterm_blend_get(uterm_blend_find()), NULL);
+
+	for (impl = 0; impl < UTERM_BLEND_NUM; ++impl) {
+		if (impl == UTERM_BLEND_SCALAR || !uterm_blend_get(impl))
+			continue;
+
+		++tested;
+		for (i = 0; i < 9; ++i) {
+			fg = (i * 0x1f3a71) & 0xffffff;
+			/* garbage in the X byte must be ignored */
+			for (j = 0; j < 9; ++j) {
+				bg = 0xff000000 | ((j * 0x1e2b13) & 0xffffff);
+				/* cover all vector tails */
+				for (w = 1; w <= 33; ++w)
+					compare_impl(impl, w, SRC_HEIGHT,
+						     fg, bg);
+				for (h = 0; h < 3; ++h)
+					compare_impl(impl, SRC_WIDTH, h,
+						     fg, bg);
+			}
+		}
+	}
+
+	if (!tested)
+		fprintf(stderr, "no SIMD blending kernel available, skipped\n");
+}
+END_TEST
+
+START_TEST(test_blend_mono)
+{
+	unsigned int impl, i, w;
+	uterm_blend_t ref_fn, fn;
+	uint32_t fg, bg;
+
+	fill_src();
+	memcpy(mono, &src[sizeof(src) - sizeof(mono)], sizeof(mono));
+	for (i = 0; i < sizeof(src); ++i)
+		src[i] = -((mono[i / 8] >> (7 - i % 8)) & 1);
+
+	ref_fn = uterm_blend_get(UTERM_BLEND_SCALAR);
+	fg = 0xff123456;
+	bg = 0x00abcdef;
+
+	for (impl = 0; impl < UTERM_BLEND_NUM; ++impl) {
+		fn = uterm_blend_get_mono(impl);
+		if (!fn)
+			continue;
+
+		for (w = 1; w <= SRC_WIDTH; ++w) {
+			memset(ref, 0xaa, sizeof(ref));
+			memset(out, 0xaa, sizeof(out));
+
+			ref_fn(ref, DST_STRIDE, src, SRC_WIDTH, w, SRC_HEIGHT,
+			       fg, bg);
+			fn(out, DST_STRIDE, mono, SRC_WIDTH / 8, w, SRC_HEIGHT,
+			   fg, bg);
+
+			ck_assert_mem_eq(ref, out, sizeof(ref));
+		}
+	}
+}
+END_TEST
+
+TEST_DEFINE_CASE(blend)
+	TEST(test_blend_reference)
+	TEST(test_blend_simd)
+	TEST(test_blend_mono)
+TEST_END_CASE
+
+TEST_DEFINE(
+	TEST_SUITE(blend,
+		TEST_CASE(blend),
+		TEST_END
+	)
+)
@@ -0,0 +1,281 @@
+/*
+ * test_font_cache - Test persistent glyph cache
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Two caches opened on the same key behave like two kmscon processes sharing
+ * one cache file. Each test runs in a fresh temporary directory.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "font_cache.h"
+#include "test_common.h"
+
+#define KEY "monospace 72 12 8 16 12 0 0"
+
+static char dir[] = "/tmp/kmscon-test-XXXXXX";
+
+static void setup(void)
+{
+	ck_assert_ptr_ne(mkdtemp(dir), NULL);
+}
+
+static void teardown(void)
+{
+	struct dirent *ent;
+	char path[PATH_MAX];
+	DIR *d;
+
+	d = opendir(dir);
+	while (d && (ent = readdir(d))) {
+		if (ent->d_name[0] == '.')
+			continue;
+		snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+		unlink(path);
+	}
+	if (d)
+		closedir(d);
+	rmdir(dir);
+	strcpy(dir, "/tmp/kmscon-test-XXXXXX");
+}
+
+/* a glyph of @cells cells with a stride that differs from its width */
+static void make_glyph(struct kmscon_glyph *glyph, uint8_t *data,
+		       unsigned int cells, uint8_t val)
+{
+	unsigned int i;
+
+	memset(glyph, 0, sizeof(*glyph));
+	glyph->width = cells;
+	glyph->buf.width = 8 * cells;
+	glyph->buf.height = 16;
+	glyph->buf.stride = 8 * cells + 4;
+	glyph->buf.format = UTERM_FORMAT_GREY;
+	glyph->buf.data = data;
+
+	for (i = 0; i < glyph->buf.stride * glyph->buf.height; ++i)
+		data[i] = val + i % glyph->buf.stride;
+}
+
+static void check_glyph(const struct kmscon_glyph *glyph, unsigned int cells,
+			uint8_t val)
+{
+	unsigned int x, y;
+
+	ck_assert_uint_eq(glyph->width, cells);
+	ck_assert_uint_eq(glyph->buf.width, 8 * cells);
+	ck_assert_uint_eq(glyph->buf.height, 16);
+	ck_assert_uint_eq(glyph->buf.stride, 8 * cells);
+	for (y = 0; y < 16; ++y)
+		for (x = 0; x < 8 * cells; ++x)
+			ck_assert_uint_eq(glyph->buf.data[y * glyph->buf.stride + x],
+					  (uint8_t)(val + x));
+}
+
+static void cache_path(char *path)
+{
+	struct dirent *ent;
+	DIR *d;
+
+	d = opendir(dir);
+	ck_assert_ptr_ne(d, NULL);
+	while ((ent = readdir(d)))
+		if (ent->d_name[0] != '.')
+			break;
+	ck_assert_ptr_ne(ent, NULL);
+	snprintf(path, PATH_MAX, "%s/%s", dir, ent->d_name);
+	closedir(d);
+}
+
+START_TEST(test_font_cache_share)
+{
+	struct kmscon_font_cache *c1, *c2;
+	struct kmscon_glyph glyph, out;
+	uint8_t data[20 * 16];
+	int ret;
+
+	setup();
+
+	ret = kmscon_font_cache_open(&c1, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_open(&c2, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+
+	ret = kmscon_font_cache_find(c1, 'a', &out);
+	ck_assert_int_eq(ret, -ENOENT);
+
+	make_glyph(&glyph, data, 1, 10);
+	ret = kmscon_font_cache_add(c1, 'a', &glyph);
+	ck_assert_int_eq(ret, 0);
+	make_glyph(&glyph, data, 2, 20);
+	ret = kmscon_font_cache_add(c1, 0x4e00, &glyph);
+	ck_assert_int_eq(ret, 0);
+
+	/* the other cache picks up appended glyphs on a miss */
+	ret = kmscon_font_cache_find(c2, 'a', &out);
+	ck_assert_int_eq(ret, 0);
+	check_glyph(&out, 1, 10);
+	ret = kmscon_font_cache_find(c2, 0x4e00, &out);
+	ck_assert_int_eq(ret, 0);
+	check_glyph(&out, 2, 20);
+	ret = kmscon_font_cache_find(c2, 'b', &out);
+	ck_assert_int_eq(ret, -ENOENT);
+
+	kmscon_font_cache_close(c2);
+	kmscon_font_cache_close(c1);
+
+	/* and they persist */
+	ret = kmscon_font_cache_open(&c1, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_find(c1, 'a', &out);
+	ck_assert_int_eq(ret, 0);
+	check_glyph(&out, 1, 10);
+	kmscon_font_cache_close(c1);
+
+	/* other faces never see them */
+	ret = kmscon_font_cache_open(&c1, dir, KEY " bold");
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_find(c1, 'a', &out);
+	ck_assert_int_eq(ret, -ENOENT);
+	kmscon_font_cache_close(c1);
+
+	teardown();
+}
+END_TEST
+
+START_TEST(test_font_cache_corrupt)
+{
+	struct kmscon_font_cache *cache;
+	struct kmscon_glyph glyph, out;
+	uint8_t data[20 * 16];
+	char path[PATH_MAX];
+	struct stat st1, st2;
+	FILE *f;
+	int ret;
+
+	setup();
+
+	ret = kmscon_font_cache_open(&cache, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	make_glyph(&glyph, data, 1, 30);
+	ret = kmscon_font_cache_add(cache, 'x', &glyph);
+	ck_assert_int_eq(ret, 0);
+	kmscon_font_cache_close(cache);
+
+	/* a writer that died while appending leaves a partial record */
+	cache_path(path);
+	ck_assert_int_eq(stat(path, &st1), 0);
+	f = fopen(path, "a");
+	ck_assert_ptr_ne(f, NULL);
+	fwrite(data, 1, 20, f);
+	fclose(f);
+
+	ret = kmscon_font_cache_open(&cache, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_int_eq(stat(path, &st2), 0);
+	ck_assert_int_eq(st1.st_size, st2.st_size);
+	ret = kmscon_font_cache_find(cache, 'x', &out);
+	ck_assert_int_eq(ret, 0);
+	check_glyph(&out, 1, 30);
+	kmscon_font_cache_close(cache);
+
+	/* a broken header drops the whole file */
+	f = fopen(path, "r+");
+	ck_assert_ptr_ne(f, NULL);
+	fwrite("XXXX", 1, 4, f);
+	fclose(f);
+
+	ret = kmscon_font_cache_open(&cache, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_find(cache, 'x', &out);
+	ck_assert_int_eq(ret, -ENOENT);
+	kmscon_font_cache_close(cache);
+
+	teardown();
+}
+END_TEST
+
+START_TEST(test_font_cache_replace)
+{
+	struct kmscon_font_cache *c1, *c2;
+	struct kmscon_glyph glyph, out, old;
+	uint8_t data[20 * 16];
+	char path[PATH_MAX], other[PATH_MAX];
+	struct stat st1, st2;
+	FILE *f;
+	int ret;
+
+	setup();
+
+	ret = kmscon_font_cache_open(&c1, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	make_glyph(&glyph, data, 1, 40);
+	ret = kmscon_font_cache_add(c1, 'y', &glyph);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_find(c1, 'y', &old);
+	ck_assert_int_eq(ret, 0);
+
+	/* a file of another version is replaced, not truncated, while c1
+	 * still has it mapped */
+	cache_path(path);
+	ck_assert_int_eq(stat(path, &st1), 0);
+	f = fopen(path, "r+");
+	ck_assert_ptr_ne(f, NULL);
+	fwrite("XXXX", 1, 4, f);
+	fclose(f);
+
+	ret = kmscon_font_cache_open(&c2, dir, KEY);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_font_cache_find(c2, 'y', &out);
+	ck_assert_int_eq(ret, -ENOENT);
+
+	cache_path(other);
+	ck_assert_str_eq(path, other);
+	ck_assert_int_eq(stat(path, &st2), 0);
+	ck_assert(st1.st_ino != st2.st_ino);
+
+	check_glyph(&old, 1, 40);
+	kmscon_font_cache_close(c2);
+	kmscon_font_cache_close(c1);
+
+	teardown();
+}
+END_TEST
+
+TEST_DEFINE_CASE(font_cache)
+	TEST(test_font_cache_share)
+	TEST(test_font_cache_corrupt)
+	TEST(test_font_cache_replace)
+TEST_END_CASE
+
+TEST_DEFINE(
+	TEST_SUITE(font_cache,
+		TEST_CASE(font_cache),
+		TEST_END
+	)
+)
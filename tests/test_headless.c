@@ -0,0 +1,439 @@
+/*
+ * test_headless - Test headless video backend
+ *
+ * Copyright (c) 2011-2013 David Herrmann <dh.herrmann@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * The headless backend needs no devices so it can run the video API like a
+ * real monitor on any machine. This checks mode selection, rendering into
+ * the back-buffer, front-buffer snapshots and fake page-flip events.
+ *
+ * The headless GL backend gets the same snapshot checks plus a gltex frame.
+ * It needs a working surfaceless EGL stack at runtime; without one these
+ * cases print a note and pass.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "eloop.h"
+#include "font.h"
+#include "test_common.h"
+#include "text.h"
+#include "uterm_video.h"
+
+#define WIDTH 64
+#define HEIGHT 32
+
+static struct ev_eloop *eloop;
+static struct uterm_video *video;
+static struct uterm_display *disp;
+static unsigned int flips;
+
+static void display_event(struct uterm_display *d,
+			  struct uterm_display_event *ev, void *data)
+{
+	if (ev->action == UTERM_PAGE_FLIP)
+		++flips;
+}
+
+static int setup_module(const char *node,
+			const struct uterm_video_module *mod)
+{
+	int ret;
+
+	ret = ev_eloop_new(&eloop, NULL, NULL);
+	ck_assert_int_eq(ret, 0);
+
+	ret = uterm_video_new(&video, eloop, node, mod);
+	if (ret) {
+		ev_eloop_unref(eloop);
+		eloop = NULL;
+		return ret;
+	}
+
+	/* the display is announced from an idle callback */
+	ret = ev_eloop_dispatch(eloop, 0);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_video_wake_up(video);
+	ck_assert_int_eq(ret, 0);
+
+	disp = uterm_video_get_displays(video);
+	ck_assert_ptr_ne(disp, NULL);
+	ret = uterm_display_activate(disp, NULL);
+	ck_assert_int_eq(ret, 0);
+
+	return 0;
+}
+
+static void setup(const char *node)
+{
+	int ret;
+
+	ret = setup_module(node, UTERM_VIDEO_HEADLESS);
+	ck_assert_int_eq(ret, 0);
+}
+
+static void teardown(void)
+{
+	uterm_video_unref(video);
+	ev_eloop_unref(eloop);
+	video = NULL;
+	disp = NULL;
+	eloop = NULL;
+}
+
+static uint32_t pixel(const struct uterm_video_buffer *buf, unsigned int x,
+		      unsigned int y)
+{
+	return ((uint32_t*)&buf->data[y * buf->stride])[x];
+}
+
+START_TEST(test_headless_mode)
+{
+	struct uterm_video *v;
+	struct uterm_mode *mode;
+	int ret;
+
+	ret = ev_eloop_new(&eloop, NULL, NULL);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_video_new(&v, eloop, "64", UTERM_VIDEO_HEADLESS);
+	ck_assert_int_eq(ret, -EINVAL);
+	ret = uterm_video_new(&v, eloop, "64x32@", UTERM_VIDEO_HEADLESS);
+	ck_assert_int_eq(ret, -EINVAL);
+	ret = uterm_video_new(&v, eloop, "0x32", UTERM_VIDEO_HEADLESS);
+	ck_assert_int_eq(ret, -EINVAL);
+	ev_eloop_unref(eloop);
+
+	setup("64x32@100");
+
+	mode = uterm_display_get_current(disp);
+	ck_assert_ptr_ne(mode, NULL);
+	ck_assert_uint_eq(uterm_mode_get_width(mode), WIDTH);
+	ck_assert_uint_eq(uterm_mode_get_height(mode), HEIGHT);
+	ck_assert_str_eq(uterm_mode_get_name(mode), "64x32@100");
+	ck_assert(uterm_display_preserves_buffers(disp));
+
+	teardown();
+}
+END_TEST
+
+static void check_snapshot(void)
+{
+	struct uterm_video_buffer buf;
+	int ret;
+
+	memset(&buf, 0, sizeof(buf));
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(buf.width, WIDTH);
+	ck_assert_uint_eq(buf.height, HEIGHT);
+	ck_assert_uint_eq(buf.format, UTERM_FORMAT_XRGB32);
+	buf.data = malloc(buf.stride * buf.height);
+	ck_assert_ptr_ne(buf.data, NULL);
+
+	ret = uterm_display_fill(disp, 0xff, 0, 0, 0, 0, WIDTH, HEIGHT);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_display_fill(disp, 0, 0, 0xff, 8, 4, 2, 2);
+	ck_assert_int_eq(ret, 0);
+
+	/* nothing is visible before the swap */
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(pixel(&buf, 0, 0), 0);
+
+	ret = uterm_display_swap(disp, true);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(pixel(&buf, 0, 0), 0xff0000);
+	ck_assert_uint_eq(pixel(&buf, 8, 4), 0x0000ff);
+	ck_assert_uint_eq(pixel(&buf, 9, 5), 0x0000ff);
+	ck_assert_uint_eq(pixel(&buf, 10, 5), 0xff0000);
+	ck_assert_uint_eq(pixel(&buf, WIDTH - 1, HEIGHT - 1), 0xff0000);
+
+	buf.width = WIDTH + 1;
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, -EINVAL);
+
+	free(buf.data);
+}
+
+START_TEST(test_headless_snapshot)
+{
+	setup("64x32");
+	check_snapshot();
+	teardown();
+}
+END_TEST
+
+START_TEST(test_headless_vblank)
+{
+	int ret, i;
+
+	setup("64x32@100");
+
+	ret = uterm_display_register_cb(disp, display_event, NULL);
+	ck_assert_int_eq(ret, 0);
+
+	flips = 0;
+	ret = uterm_display_swap(disp, false);
+	ck_assert_int_eq(ret, 0);
+	ck_assert(uterm_display_is_swapping(disp));
+
+	for (i = 0; i < 100 && !flips; ++i)
+		ev_eloop_dispatch(eloop, 100);
+
+	ck_assert_uint_eq(flips, 1);
+	ck_assert(!uterm_display_is_swapping(disp));
+
+	uterm_display_unregister_cb(disp, display_event, NULL);
+	teardown();
+}
+END_TEST
+
+#ifdef BUILD_ENABLE_RENDERER_BBULK
+
+static void draw_cell(struct kmscon_text *txt, tsm_age_t age,
+		      const struct kmscon_text_cell *cell)
+{
+	struct tsm_screen_attr attr;
+	int ret;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.fccode = -1;
+	attr.bccode = -1;
+	attr.fr = 0xff;
+	attr.fg = 0xff;
+	attr.fb = 0xff;
+
+	ret = kmscon_text_prepare(txt, age);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_draw_run(txt, 0, 0, cell, &attr, 1);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_render(txt);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_display_swap(disp, true);
+	ck_assert_int_eq(ret, 0);
+}
+
+/* a frame that only blanks cells must still clear the old glyphs */
+START_TEST(test_headless_bbulk_blank)
+{
+	static const uint32_t block = 0x2588;
+	const struct kmscon_text_cell glyph = { block, &block, 1, 1 };
+	const struct kmscon_text_cell blank = { 0, NULL, 0, 1 };
+	struct kmscon_font_attr attr;
+	struct kmscon_font *font;
+	struct kmscon_text *txt;
+	struct uterm_video_buffer buf;
+	unsigned int x, y, lit = 0;
+	int ret;
+
+	setup("64x32");
+
+	ret = kmscon_font_register(&kmscon_font_8x16_ops);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_register(&kmscon_text_bbulk_ops);
+	ck_assert_int_eq(ret, 0);
+
+	memset(&attr, 0, sizeof(attr));
+	attr.ppi = 96;
+	attr.points = 12;
+	ret = kmscon_font_find(&font, &attr, "8x16");
+	ck_assert_int_eq(ret, 0);
+
+	ret = kmscon_text_new(&txt, "bbulk", "normal");
+	ck_assert_int_eq(ret, 0);
+	ck_assert_str_eq(txt->ops->name, "bbulk");
+	ret = kmscon_text_set(txt, font, font, disp);
+	ck_assert_int_eq(ret, 0);
+
+	/* put the glyph into both buffers, then blank it on an aged frame */
+	draw_cell(txt, 0, &glyph);
+	draw_cell(txt, 0, &glyph);
+
+	memset(&buf, 0, sizeof(buf));
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	buf.data = malloc(buf.stride * buf.height);
+	ck_assert_ptr_ne(buf.data, NULL);
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	for (y = 0; y < 16; ++y)
+		for (x = 0; x < 8; ++x)
+			lit += pixel(&buf, x, y) != 0;
+	ck_assert_uint_gt(lit, 0);
+
+	draw_cell(txt, 1, &blank);
+
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	for (y = 0; y < 16; ++y)
+		for (x = 0; x < 8; ++x)
+			ck_assert_uint_eq(pixel(&buf, x, y), 0);
+
+	free(buf.data);
+	kmscon_text_unref(txt);
+	kmscon_font_unref(font);
+	kmscon_text_unregister(kmscon_text_bbulk_ops.name);
+	kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	teardown();
+}
+END_TEST
+
+#endif /* BUILD_ENABLE_RENDERER_BBULK */
+
+#ifdef BUILD_ENABLE_VIDEO_HEADLESS_GL
+
+static bool setup_gl(const char *node)
+{
+	int ret;
+
+	ret = setup_module(node, UTERM_VIDEO_HEADLESS_GL);
+	if (ret) {
+		fprintf(stderr, "headless GL backend not available (%d), skipped\n",
+			ret);
+		return false;
+	}
+
+	return true;
+}
+
+START_TEST(test_headless_gl_snapshot)
+{
+	bool opengl = false;
+	int ret;
+
+	if (!setup_gl("64x32"))
+		return;
+
+	ck_assert(!uterm_display_preserves_buffers(disp));
+	ret = uterm_display_use(disp, &opengl);
+	ck_assert_int_eq(ret, 0);
+	ck_assert(opengl);
+
+	check_snapshot();
+	teardown();
+}
+END_TEST
+
+#ifdef BUILD_ENABLE_RENDERER_GLTEX
+
+/* renders one full block with gltex, it must show up in the top-left cell */
+START_TEST(test_headless_gl_gltex)
+{
+	static const uint32_t block = 0x2588;
+	struct kmscon_font_attr attr;
+	struct kmscon_font *font;
+	struct kmscon_text *txt;
+	struct tsm_screen_attr sattr;
+	struct uterm_video_buffer buf;
+	unsigned int x, y, lit = 0;
+	int ret;
+
+	if (!setup_gl("64x32"))
+		return;
+
+	ret = kmscon_font_register(&kmscon_font_8x16_ops);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_register(&kmscon_text_gltex_ops);
+	ck_assert_int_eq(ret, 0);
+
+	memset(&attr, 0, sizeof(attr));
+	attr.ppi = 96;
+	attr.points = 12;
+	ret = kmscon_font_find(&font, &attr, "8x16");
+	ck_assert_int_eq(ret, 0);
+
+	ret = kmscon_text_new(&txt, "gltex", "normal");
+	ck_assert_int_eq(ret, 0);
+	ck_assert_str_eq(txt->ops->name, "gltex");
+	ret = kmscon_text_set(txt, font, font, disp);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(kmscon_text_get_cols(txt), WIDTH / 8);
+	ck_assert_uint_eq(kmscon_text_get_rows(txt), HEIGHT / 16);
+
+	memset(&sattr, 0, sizeof(sattr));
+	sattr.fccode = -1;
+	sattr.bccode = -1;
+	sattr.fr = 0xff;
+	sattr.fg = 0xff;
+	sattr.fb = 0xff;
+
+	ret = kmscon_text_prepare(txt, 0);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_draw(txt, block, &block, 1, 1, 0, 0, &sattr);
+	ck_assert_int_eq(ret, 0);
+	ret = kmscon_text_render(txt);
+	ck_assert_int_eq(ret, 0);
+	ret = uterm_display_swap(disp, true);
+	ck_assert_int_eq(ret, 0);
+
+	memset(&buf, 0, sizeof(buf));
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+	buf.data = malloc(buf.stride * buf.height);
+	ck_assert_ptr_ne(buf.data, NULL);
+	ret = uterm_display_snapshot(disp, &buf);
+	ck_assert_int_eq(ret, 0);
+
+	for (y = 0; y < 16; ++y)
+		for (x = 0; x < 8; ++x)
+			lit += pixel(&buf, x, y) == 0xffffff;
+	ck_assert_uint_gt(lit, 0);
+	ck_assert_uint_eq(pixel(&buf, WIDTH - 1, HEIGHT - 1), 0);
+
+	free(buf.data);
+	kmscon_text_unref(txt);
+	kmscon_font_unref(font);
+	kmscon_text_unregister(kmscon_text_gltex_ops.name);
+	kmscon_font_unregister(kmscon_font_8x16_ops.name);
+	teardown();
+}
+END_TEST
+
+#endif /* BUILD_ENABLE_RENDERER_GLTEX */
+
+#endif /* BUILD_ENABLE_VIDEO_HEADLESS_GL */
+
+TEST_DEFINE_CASE(headless)
+	TEST(test_headless_mode)
+	TEST(test_headless_snapshot)
+	TEST(test_headless_vblank)
+#ifdef BUILD_ENABLE_RENDERER_BBULK
+	TEST(test_headless_bbulk_blank)
+#endif
+#ifdef BUILD_ENABLE_VIDEO_HEADLESS_GL
+	TEST(test_headless_gl_snapshot)
+#ifdef BUILD_ENABLE_RENDERER_GLTEX
+	TEST(test_headless_gl_gltex)
+#endif
+#endif
+TEST_END_CASE
+
+TEST_DEFINE(
+	TEST_SUITE(headless,
+		TEST_CASE(headless),
+		TEST_END
+	)
+)
@@ -24,6 +24,8 @@
  */
 
 #include "test_common.h"
+#include "shl_cache.h"
+#include "shl_hashtable.h"
 #include "shl_misc.h"
 
 #define check_assert_string_list_eq(X, Y) \
@@ -165,13 +167,178 @@ START_TEST(test_split_command_string)
 }
 END_TEST
 
+static unsigned int hashtable_freed;
+
+static void hashtable_free_value(void *data)
+{
+	++hashtable_freed;
+}
+
+START_TEST(test_hashtable_remove)
+{
+	struct shl_hashtable *tbl;
+	unsigned int values[3];
+	void *out;
+	int ret;
+
+	ret = shl_hashtable_new(&tbl, shl_direct_hash, shl_direct_equal,
+				hashtable_free_value);
+	ck_assert_int_eq(ret, 0);
+
+	hashtable_freed = 0;
+	ret = shl_hashtable_insert(tbl, 1, &values[0]);
+	ck_assert_int_eq(ret, 0);
+	ret = shl_hashtable_insert(tbl, 2, &values[1]);
+	ck_assert_int_eq(ret, 0);
+	ret = shl_hashtable_insert(tbl, 3, &values[2]);
+	ck_assert_int_eq(ret, 0);
+
+	shl_hashtable_remove(tbl, 2);
+	ck_assert_uint_eq(hashtable_freed, 1);
+	ck_assert(!shl_hashtable_find(tbl, NULL, 2));
+	ck_assert(shl_hashtable_find(tbl, &out, 1));
+	ck_assert_ptr_eq(out, &values[0]);
+
+	/* removing unknown keys is a no-op */
+	shl_hashtable_remove(tbl, 2);
+	ck_assert_uint_eq(hashtable_freed, 1);
+
+	/* cleared tables stay usable */
+	shl_hashtable_clear(tbl);
+	ck_assert_uint_eq(hashtable_freed, 3);
+	ck_assert(!shl_hashtable_find(tbl, NULL, 1));
+	ck_assert(!shl_hashtable_find(tbl, NULL, 3));
+
+	ret = shl_hashtable_insert(tbl, 3, &values[2]);
+	ck_assert_int_eq(ret, 0);
+	ck_assert(shl_hashtable_find(tbl, &out, 3));
+	ck_assert_ptr_eq(out, &values[2]);
+
+	shl_hashtable_free(tbl);
+	ck_assert_uint_eq(hashtable_freed, 4);
+}
+END_TEST
+
+START_TEST(test_cache_evict)
+{
+	struct shl_cache *cache;
+	struct shl_cache_stats stats;
+	unsigned int values[4];
+	void *out;
+	int ret;
+
+	ret = shl_cache_new(&cache, 30, hashtable_free_value);
+	ck_assert_int_eq(ret, 0);
+
+	hashtable_freed = 0;
+	ret = shl_cache_insert(cache, 1, &values[0], 10);
+	ck_assert_int_eq(ret, 0);
+	ret = shl_cache_insert(cache, 2, &values[1], 10);
+	ck_assert_int_eq(ret, 0);
+	ret = shl_cache_insert(cache, 3, &values[2], 10);
+	ck_assert_int_eq(ret, 0);
+
+	/* values of the current frame are never evicted */
+	ret = shl_cache_insert(cache, 4, &values[3], 10);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(hashtable_freed, 0);
+	shl_cache_get_stats(cache, &stats);
+	ck_assert_uint_eq(stats.size, 40);
+	ck_assert_uint_eq(stats.num, 4);
+
+	/* the least recently used ones go once the frame is over */
+	ck_assert(shl_cache_find(cache, &out, 1));
+	ck_assert_ptr_eq(out, &values[0]);
+	shl_cache_next_frame(cache);
+	ck_assert_uint_eq(hashtable_freed, 1);
+	ck_assert(!shl_cache_find(cache, NULL, 2));
+	ck_assert(shl_cache_find(cache, NULL, 1));
+
+	/* 1 was used in this frame, so 3 goes next */
+	ret = shl_cache_insert(cache, 2, &values[1], 10);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(hashtable_freed, 2);
+	ck_assert(!shl_cache_find(cache, NULL, 3));
+	ck_assert(shl_cache_find(cache, NULL, 4));
+
+	shl_cache_get_stats(cache, &stats);
+	ck_assert_uint_eq(stats.hits, 3);
+	ck_assert_uint_eq(stats.misses, 2);
+	ck_assert_uint_eq(stats.evictions, 2);
+	ck_assert_uint_eq(stats.size, 30);
+	ck_assert_uint_eq(stats.num, 3);
+
+	/* removing does not count as eviction */
+	shl_cache_remove(cache, 4);
+	ck_assert_uint_eq(hashtable_freed, 3);
+	shl_cache_get_stats(cache, &stats);
+	ck_assert_uint_eq(stats.evictions, 2);
+	ck_assert_uint_eq(stats.size, 20);
+
+	/* 0 is unlimited */
+	shl_cache_set_budget(cache, 0);
+	shl_cache_next_frame(cache);
+	ret = shl_cache_insert(cache, 3, &values[2], 100);
+	ck_assert_int_eq(ret, 0);
+	ck_assert_uint_eq(hashtable_freed, 3);
+
+	shl_cache_free(cache);
+	ck_assert_uint_eq(hashtable_freed, 6);
+}
+END_TEST
+
+static bool cache_match_value(const void *value, const void *data)
+{
+	return *(const unsigned int*)value == *(const unsigned int*)data;
+}
+
+START_TEST(test_cache_match)
+{
+	struct shl_cache *cache;
+	struct shl_cache_stats stats;
+	unsigned int value = 5, other = 6;
+	void *out;
+	int ret;
+
+	ret = shl_cache_new(&cache, 0, NULL);
+	ck_assert_int_eq(ret, 0);
+
+	ret = shl_cache_insert(cache, 1, &value, 10);
+	ck_assert_int_eq(ret, 0);
+
+	/* values that do not match are misses, not hits */
+	ck_assert(!shl_cache_find_match(cache, &out, 1, cache_match_value,
+					&other));
+	ck_assert(shl_cache_find_match(cache, &out, 1, cache_match_value,
+				       &value));
+	ck_assert_ptr_eq(out, &value);
+
+	shl_cache_get_stats(cache, &stats);
+	ck_assert_uint_eq(stats.hits, 1);
+	ck_assert_uint_eq(stats.misses, 1);
+
+	shl_cache_free(cache);
+}
+END_TEST
+
 TEST_DEFINE_CASE(misc)
 	TEST(test_split_command_string)
 TEST_END_CASE
 
+TEST_DEFINE_CASE(hashtable)
+	TEST(test_hashtable_remove)
+TEST_END_CASE
+
+TEST_DEFINE_CASE(cache)
+	TEST(test_cache_evict)
+	TEST(test_cache_match)
+TEST_END_CASE
+
 TEST_DEFINE(
 	TEST_SUITE(shl,
 		TEST_CASE(misc),
+		TEST_CASE(hashtable),
+		TEST_CASE(cache),
 		TEST_END
 	)
 )